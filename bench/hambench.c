@@ -0,0 +1,211 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "../fontscan.h"
+#include "../fontderive.h"
+#include "../cpudetect.h"
+
+// Сравнение реализаций glyph_distance_min, glyph_row_stats и derive_apply: сначала
+// проверка, что векторные версии дают тот же результат, что и скалярные,
+// затем замер скорости для разного числа глифов
+
+#define ITERATIONS 200000
+#define MAX_GLYPHS 256
+#define GLYPH 16
+
+typedef int (*dist_fn)(const uint8_t *, const uint8_t *, int);
+
+typedef struct {
+    const char *name;
+    dist_fn fn;
+} impl_t;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Окно - копия случайного глифа с несколькими изменёнными битами, чтобы
+// минимум приходился на разные позиции, в том числе на хвост
+static void make_window(const uint8_t *glyphs, int n, uint8_t *window) {
+    if (n == 0 || rand() % 4 == 0) {
+        for (int i = 0; i < GLYPH; i++) {
+            window[i] = rand();
+        }
+        return;
+    }
+    memcpy(window, glyphs + (rand() % n) * GLYPH, GLYPH);
+    for (int flips = rand() % 6; flips > 0; flips--) {
+        int bit = rand() % (GLYPH * 8);
+        window[bit / 8] ^= 1 << (bit % 8);
+    }
+}
+
+static int check_impl(const impl_t *impl, const uint8_t *glyphs) {
+    uint8_t window[GLYPH];
+    for (int n = 0; n <= MAX_GLYPHS; n++) {
+        for (int k = 0; k < 20; k++) {
+            make_window(glyphs, n, window);
+            int ref = glyph_distance_min_scalar(window, glyphs, n);
+            int got = impl->fn(window, glyphs, n);
+            if (ref != got) {
+                fprintf(stderr, "%s differs: %d glyphs, %d instead of %d\n", impl->name, n, got, ref);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+// Статистика строк для всех длин до 400 байт: векторный цикл и хвост
+static int check_row_stats(const uint8_t *rows) {
+#ifdef CPU_X86
+    for (int len = 0; len <= 400; len++) {
+        glyph_row_stats_t ref, got;
+        glyph_row_stats_scalar(rows, len, &ref);
+        glyph_row_stats_avx2(rows, len, &got);
+        if (ref.zero_rows != got.zero_rows || ref.changed_bits != got.changed_bits) {
+            fprintf(stderr, "avx2 row stats differ: %d rows\n", len);
+            return 1;
+        }
+    }
+#else
+    (void)rows;
+#endif
+    return 0;
+}
+
+// Уменьшение шрифта со случайными группами строк для всех пар высот
+// источника до 16 строк
+static int check_derive(const uint8_t *glyphs) {
+#ifdef CPU_X86
+    uint8_t ref[DERIVE_GLYPHS * GLYPH], got[DERIVE_GLYPHS * GLYPH];
+    for (int sh = 1; sh <= GLYPH; sh++) {
+        for (int dh = 1; dh <= sh; dh++) {
+            derive_map_t map;
+            if (derive_plan(glyphs, sh, dh, &map) != 0) {
+                fprintf(stderr, "derive_plan failed: %d -> %d rows\n", sh, dh);
+                return 1;
+            }
+            derive_apply_scalar(glyphs, &map, ref);
+            derive_apply_avx2(glyphs, &map, got);
+            if (memcmp(ref, got, DERIVE_GLYPHS * dh) != 0) {
+                fprintf(stderr, "avx2 derive differs: %d -> %d rows\n", sh, dh);
+                return 1;
+            }
+        }
+    }
+#else
+    (void)glyphs;
+#endif
+    return 0;
+}
+
+static double time_fn(dist_fn fn, const uint8_t *windows, const uint8_t *glyphs, int n) {
+    volatile int sink = 0;
+    double t0 = now_sec();
+    for (int it = 0; it < ITERATIONS; it++) {
+        sink += fn(windows + (it & 63) * GLYPH, glyphs, n);
+    }
+    (void)sink;
+    return (now_sec() - t0) * 1e9 / ITERATIONS;
+}
+
+int main(void) {
+    impl_t impls[3];
+    int nimpl = 0;
+    int rc = 0;
+
+    impls[nimpl++] = (impl_t){ "scalar", glyph_distance_min_scalar };
+#ifdef CPU_X86
+    if (cpu_have_popcnt()) {
+        impls[nimpl++] = (impl_t){ "popcnt", glyph_distance_min_popcnt };
+        if (cpu_have_avx2()) {
+            impls[nimpl++] = (impl_t){ "avx2", glyph_distance_min_avx2 };
+        }
+    }
+#endif
+
+    uint8_t *glyphs = malloc(MAX_GLYPHS * GLYPH);
+    uint8_t *windows = malloc(64 * GLYPH);
+    srand(1);
+    for (int i = 0; i < MAX_GLYPHS * GLYPH; i++) {
+        glyphs[i] = rand();
+    }
+    for (int i = 0; i < 64; i++) {
+        make_window(glyphs, MAX_GLYPHS, windows + i * GLYPH);
+    }
+
+    for (int k = 1; k < nimpl; k++) {
+        rc |= check_impl(&impls[k], glyphs);
+    }
+    // Нулевые строки, как у глифов, чтобы проверялся и их подсчёт
+    uint8_t *rows = malloc(400);
+    for (int i = 0; i < 400; i++) {
+        rows[i] = rand() % 3 == 0 ? 0 : glyphs[i];
+    }
+    if (nimpl == 3) {
+        rc |= check_row_stats(rows);
+        rc |= check_derive(glyphs);
+    }
+    printf("Correctness check: %s\n\n", rc ? "FAILED" : "ok");
+    printf("Dispatch: %s, %d iterations\n", glyph_distance_impl(), ITERATIONS);
+    printf("%-8s %-8s %10s %14s\n", "glyphs", "impl", "ns", "Mglyphs/s");
+
+    const int counts[] = { 4, 16, 64, 256 };
+    for (int c = 0; c < 4; c++) {
+        for (int k = 0; k < nimpl; k++) {
+            double ns = time_fn(impls[k].fn, windows, glyphs, counts[c]);
+            printf("%-8d %-8s %10.1f %14.1f\n", counts[c], impls[k].name, ns, counts[c] / ns * 1e3);
+        }
+    }
+
+    // Статистика строк 94 печатных символов 8x16, как при оценке таблицы
+    glyph_row_stats_t st;
+    double t0 = now_sec();
+    for (int it = 0; it < ITERATIONS; it++) {
+        glyph_row_stats(glyphs, 94 * GLYPH, &st);
+        __asm__ volatile("" : : "r"(&st) : "memory");
+    }
+    printf("\nglyph_row_stats, %d rows: %.1f ns\n", 94 * GLYPH, (now_sec() - t0) * 1e9 / ITERATIONS);
+
+    // Шрифт 8x14 и 8x8 из 8x16: выбор групп строк и построение
+    static const int heights[] = { 14, 8 };
+    uint8_t out[DERIVE_GLYPHS * GLYPH];
+    for (int h = 0; h < 2; h++) {
+        derive_map_t map;
+        t0 = now_sec();
+        for (int it = 0; it < ITERATIONS / 100; it++) {
+            derive_plan(glyphs, GLYPH, heights[h], &map);
+        }
+        double plan_ns = (now_sec() - t0) * 1e9 / (ITERATIONS / 100);
+        printf("derive 8x16 -> 8x%d: plan %.1f ns", heights[h], plan_ns);
+        derive_apply(glyphs, &map, out);
+
+        void (*apply[2])(const uint8_t *, const derive_map_t *, uint8_t *) = { derive_apply_scalar, NULL };
+        const char *names[2] = { "scalar", NULL };
+#ifdef CPU_X86
+        if (cpu_have_avx2()) {
+            apply[1] = derive_apply_avx2;
+            names[1] = "avx2";
+        }
+#endif
+        for (int k = 0; k < 2 && apply[k]; k++) {
+            t0 = now_sec();
+            for (int it = 0; it < ITERATIONS / 10; it++) {
+                apply[k](glyphs, &map, out);
+                __asm__ volatile("" : : "r"(out) : "memory");
+            }
+            printf(", %s %.1f ns", names[k], (now_sec() - t0) * 1e9 / (ITERATIONS / 10));
+        }
+        printf("\n");
+    }
+
+    free(glyphs);
+    free(windows);
+    free(rows);
+    return rc;
+}
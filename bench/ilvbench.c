@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "../interleave.h"
+
+// Сравнение реализаций deinterleave/interleave: сначала проверка, что
+// векторные версии дают те же байты, что и скалярная, затем замер скорости
+
+#define ITERATIONS 20000
+
+typedef void (*ilv_fn)(const uint8_t *, uint8_t *, int, int);
+
+typedef struct {
+    const char *name;
+    ilv_fn deinterleave;
+    ilv_fn interleave;
+} impl_t;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Сверяет результат реализации со скалярной версией для одного размера
+static int check_size(const impl_t *impl, const uint8_t *src, int size, int odd_offset) {
+    uint8_t *ref = malloc(size + 64);
+    uint8_t *got = malloc(size + 64);
+    int rc = 0;
+
+    // Байты за концом буфера тоже сравниваются: запись за границу - ошибка
+    memset(ref, 0xCC, size + 64);
+    memset(got, 0xCC, size + 64);
+    deinterleave_scalar(src, ref, size, odd_offset);
+    impl->deinterleave(src, got, size, odd_offset);
+    if (memcmp(ref, got, size + 64) != 0) {
+        fprintf(stderr, "%s deinterleave differs: size %d, odd offset 0x%X\n", impl->name, size, odd_offset);
+        rc = 1;
+    }
+
+    memset(ref, 0xCC, size + 64);
+    memset(got, 0xCC, size + 64);
+    interleave_scalar(src, ref, size, odd_offset);
+    impl->interleave(src, got, size, odd_offset);
+    if (memcmp(ref, got, size + 64) != 0) {
+        fprintf(stderr, "%s interleave differs: size %d, odd offset 0x%X\n", impl->name, size, odd_offset);
+        rc = 1;
+    }
+
+    free(ref);
+    free(got);
+    return rc;
+}
+
+static double time_fn(ilv_fn fn, const uint8_t *src, uint8_t *dst, int size, int odd_offset) {
+    double t0 = now_sec();
+    for (int it = 0; it < ITERATIONS; it++) {
+        fn(src, dst, size, odd_offset);
+        __asm__ volatile("" : : "r"(dst) : "memory");
+    }
+    return (now_sec() - t0) * 1e9 / ITERATIONS;
+}
+
+int main(void) {
+    impl_t impls[3];
+    int nimpl = 0;
+    const int max_size = 0x10000;
+    int rc = 0;
+
+    impls[nimpl++] = (impl_t){ "scalar", deinterleave_scalar, interleave_scalar };
+#ifdef CPU_X86
+    impls[nimpl++] = (impl_t){ "sse2", deinterleave_sse2, interleave_sse2 };
+    if (cpu_have_avx2()) {
+        impls[nimpl++] = (impl_t){ "avx2", deinterleave_avx2, interleave_avx2 };
+    }
+#endif
+
+    uint8_t *src = malloc(max_size + 64);
+    uint8_t *dst = malloc(max_size + 64);
+    srand(1);
+    for (int i = 0; i < max_size + 64; i++) {
+        src[i] = rand();
+    }
+
+    // Все размеры до 300 байт, включая нечётные, и размеры образов ПЗУ
+    for (int k = 1; k < nimpl; k++) {
+        for (int size = 1; size <= 300; size++) {
+            rc |= check_size(&impls[k], src, size, (size + 1) / 2);
+        }
+        rc |= check_size(&impls[k], src, 0x8000, ODD_BANK_OFFSET);
+        rc |= check_size(&impls[k], src, 0x8001, ODD_BANK_OFFSET + 1);
+        rc |= check_size(&impls[k], src, 0x10000, 0x8000);
+        rc |= check_size(&impls[k], src, 0xFFFF, 0x8000);
+    }
+    printf("Correctness check: %s\n\n", rc ? "FAILED" : "ok");
+    printf("Dispatch: %s, %d iterations\n", interleave_impl(), ITERATIONS);
+    printf("%-8s %-8s %-14s %10s %10s\n", "size", "impl", "operation", "ns", "MB/s");
+
+    const int sizes[] = { 0x8000, 0x10000 };
+    for (int s = 0; s < 2; s++) {
+        int size = sizes[s];
+        for (int k = 0; k < nimpl; k++) {
+            double ns = time_fn(impls[k].deinterleave, src, dst, size, size / 2);
+            printf("%-8d %-8s %-14s %10.0f %10.1f\n", size, impls[k].name, "deinterleave",
+                   ns, size / ns * 1e9 / (1024 * 1024));
+            ns = time_fn(impls[k].interleave, src, dst, size, size / 2);
+            printf("%-8d %-8s %-14s %10.0f %10.1f\n", size, impls[k].name, "interleave",
+                   ns, size / ns * 1e9 / (1024 * 1024));
+        }
+    }
+
+    free(src);
+    free(dst);
+    return rc;
+}
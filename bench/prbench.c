@@ -0,0 +1,229 @@
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "../patreplace.h"
+#include "../fontscan.h"
+
+// Сравнение замены шаблона в utils/pattern_replace: прежний цикл с
+// fwrite на каждый байт и memcmp на каждой позиции против поиска
+// patreplace_find с копированием промежутков одним write. Образы
+// синтетические, со вставленными копиями шаблона; сначала проверяется,
+// что результаты побайтно совпадают.
+
+#define ITERATIONS 5
+
+typedef struct {
+    const char *name;
+    size_t size;            // размер образа
+    size_t find_len;
+    size_t repl_len;
+    size_t spacing;         // среднее расстояние между копиями шаблона
+} bench_case_t;
+
+static const bench_case_t cases[] = {
+    { "glyph-16-to-16", 4 << 20, 16, 16, 4096 },
+    { "glyph-16-to-14", 4 << 20, 16, 14, 4096 },
+    { "sig-4-to-6",     16 << 20, 4, 6, 65536 },
+    { "byte-2-to-2",    16 << 20, 2, 2, 1024 },
+};
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Прежняя реализация из utils/pattern_replace.c
+static int search_and_replace_old(unsigned char* source, size_t source_size,
+                                  unsigned char* find_pattern, size_t find_size,
+                                  unsigned char* replace_pattern, size_t replace_size,
+                                  const char* output_filename) {
+    FILE* output_file = fopen(output_filename, "wb");
+    if (!output_file) {
+        fprintf(stderr, "Error: Could not create output file %s\n", output_filename);
+        return -1;
+    }
+
+    size_t pos = 0;
+    int replacements = 0;
+
+    while (pos <= source_size - find_size) {
+        if (memcmp(source + pos, find_pattern, find_size) == 0) {
+            fwrite(replace_pattern, 1, replace_size, output_file);
+            pos += find_size;
+            replacements++;
+        } else {
+            fwrite(&source[pos], 1, 1, output_file);
+            pos++;
+        }
+    }
+
+    if (pos < source_size) {
+        fwrite(&source[pos], 1, source_size - pos, output_file);
+    }
+
+    fclose(output_file);
+    return replacements;
+}
+
+// Новая: поиск, сборка в буфере и одна запись
+static int search_and_replace_new(const uint8_t *source, size_t source_size,
+                                  const uint8_t *find, size_t find_len,
+                                  const uint8_t *repl, size_t repl_len,
+                                  uint8_t *out, const char *output_filename) {
+    size_t *matches;
+    long n = patreplace_find(source, source_size, find, find_len, &matches);
+    if (n < 0) {
+        return -1;
+    }
+    size_t size = patreplace_size(source_size, n, find_len, repl_len);
+    patreplace_copy(source, source_size, matches, n, find_len, repl, repl_len, out);
+    free(matches);
+
+    int fd = open(output_filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1 || write(fd, out, size) != (ssize_t)size) {
+        perror(output_filename);
+        if (fd != -1) {
+            close(fd);
+        }
+        return -1;
+    }
+    close(fd);
+    return (int)n;
+}
+
+// Равная длина: только поиск и запись вхождений на месте
+static int replace_inplace_new(uint8_t *data, size_t size,
+                               const uint8_t *find, size_t find_len, const uint8_t *repl) {
+    size_t *matches;
+    long n = patreplace_find(data, size, find, find_len, &matches);
+    if (n < 0) {
+        return -1;
+    }
+    patreplace_inplace(data, matches, n, repl, find_len);
+    free(matches);
+    return (int)n;
+}
+
+static uint8_t *read_back(const char *path, size_t *size) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = malloc(*size ? *size : 1);
+    if (data && fread(data, 1, *size, f) != *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+// Образ из случайных байт с копиями шаблона; в конце - копия,
+// обрезанная посередине, для проверки хвоста
+static uint8_t *make_image(const bench_case_t *c, const uint8_t *find) {
+    uint8_t *data = malloc(c->size);
+    for (size_t i = 0; i < c->size; i++) {
+        data[i] = rand();
+    }
+    for (size_t pos = rand() % c->spacing; pos + c->find_len <= c->size;
+         pos += 1 + rand() % (2 * c->spacing)) {
+        memcpy(data + pos, find, c->find_len);
+    }
+    memcpy(data + c->size - c->find_len / 2, find, c->find_len / 2);
+    return data;
+}
+
+static int run_case(const bench_case_t *c, const char *old_path, const char *new_path) {
+    uint8_t find[16], repl[16];
+    for (int i = 0; i < 16; i++) {
+        find[i] = rand();
+        repl[i] = rand();
+    }
+    uint8_t *image = make_image(c, find);
+    uint8_t *out = malloc(c->size + c->size / c->find_len * c->repl_len);
+
+    // Проверка: одинаковое число замен и одинаковые файлы
+    int n_old = search_and_replace_old(image, c->size, find, c->find_len, repl, c->repl_len, old_path);
+    int n_new = search_and_replace_new(image, c->size, find, c->find_len, repl, c->repl_len, out, new_path);
+    size_t old_size = 0, new_size = 0;
+    uint8_t *old_data = read_back(old_path, &old_size);
+    uint8_t *new_data = read_back(new_path, &new_size);
+    int ok = n_old == n_new && old_data && new_data && old_size == new_size &&
+             memcmp(old_data, new_data, old_size) == 0;
+    if (ok && c->find_len == c->repl_len) {
+        uint8_t *copy = malloc(c->size);
+        memcpy(copy, image, c->size);
+        ok = replace_inplace_new(copy, c->size, find, c->find_len, repl) == n_old &&
+             memcmp(copy, old_data, c->size) == 0;
+        free(copy);
+    }
+    free(old_data);
+    free(new_data);
+    if (!ok) {
+        fprintf(stderr, "%s: results differ (%d and %d replacements)\n", c->name, n_old, n_new);
+        free(image);
+        free(out);
+        return 1;
+    }
+
+    double t0 = now_sec();
+    for (int it = 0; it < ITERATIONS; it++) {
+        search_and_replace_old(image, c->size, find, c->find_len, repl, c->repl_len, old_path);
+    }
+    double t_old = (now_sec() - t0) / ITERATIONS;
+
+    t0 = now_sec();
+    for (int it = 0; it < ITERATIONS; it++) {
+        search_and_replace_new(image, c->size, find, c->find_len, repl, c->repl_len, out, new_path);
+    }
+    double t_new = (now_sec() - t0) / ITERATIONS;
+
+    printf("%-16s %6zu KB %8d %10.2f %10.2f %8.1fx", c->name, c->size >> 10, n_old,
+           t_old * 1e3, t_new * 1e3, t_old / t_new);
+
+    if (c->find_len == c->repl_len) {
+        // Замена туда и обратно, чтобы образ почти не менялся между итерациями
+        t0 = now_sec();
+        for (int it = 0; it < ITERATIONS; it++) {
+            replace_inplace_new(image, c->size, find, c->find_len, repl);
+            replace_inplace_new(image, c->size, repl, c->find_len, find);
+        }
+        printf(" %10.2f", (now_sec() - t0) / (2 * ITERATIONS) * 1e3);
+    }
+    printf("\n");
+
+    free(image);
+    free(out);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    const char *dir = argc > 1 ? argv[1] : "/tmp";
+    char old_path[4096], new_path[4096];
+    int rc = 0;
+
+    snprintf(old_path, sizeof(old_path), "%s/prbench_old.bin", dir);
+    snprintf(new_path, sizeof(new_path), "%s/prbench_new.bin", dir);
+    srand(1);
+
+    printf("Search: find_signature %s, %d iterations, times in ms\n",
+           find_signature_impl(), ITERATIONS);
+    printf("%-16s %9s %8s %10s %10s %9s %10s\n",
+           "case", "size", "matches", "old", "new", "speedup", "in place");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        rc |= run_case(&cases[i], old_path, new_path);
+    }
+    printf("\nCorrectness check: %s\n", rc ? "FAILED" : "ok");
+
+    unlink(old_path);
+    unlink(new_path);
+    return rc;
+}
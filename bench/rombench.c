@@ -0,0 +1,439 @@
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "../fontreg.h"
+#include "../interleave.h"
+#include "../vgarom.h"
+#include "../fontderive.h"
+
+// Бенчмарк конвейера fontupdate по фазам и целиком на синтетических
+// образах 32 КБ - 1 МБ и на образах из командной строки.
+//
+//   rombench [--save <файл>] [--compare <файл>] [образ ...]
+//   rombench --gen <размер> <файл>   - записать синтетический образ
+//
+// Синтетический образ: заголовок 55 AA, псевдослучайный "код", три
+// таблицы шрифтов по случайным адресам, ложные якоря 7E 81 A5 81 с
+// короткими сериями нулей и копии глифов DOS-шрифта, разбросанные
+// по образу (как у карт, которые подгружают символы из кода).
+// Образ 32 КБ хранится в чётно-нечётном порядке, как firmware_ru,
+// образы больше - в линейном (банки со сдвигом 0x4000 у них
+// перекрываются). Каждое измерение повторяется, пока не наберётся
+// MIN_TIME секунд.
+
+#define MIN_TIME        0.05
+#define DECOYS_PER_32K  24
+#define COPIES_PER_32K  32
+#define CHANGED_GLYPHS  48      // символы DOS-шрифта, отличные от ROM
+
+typedef struct {
+    char name[64];
+    uint8_t *image;         // вход fontupdate
+    int size;
+    unsigned flags;         // VGAROM_LINEAR для линейного образа
+    uint8_t dosfont[FONT_8X16_SIZE];
+} bench_rom_t;
+
+// Результаты измерений для сравнения с базовой линией
+typedef struct {
+    char image[64];
+    char phase[32];
+    double ns;
+} result_t;
+
+static result_t *results = NULL;
+static int nresults = 0;
+static result_t *baseline = NULL;
+static int nbaseline = 0;
+
+// Встроенный шрифт по умолчанию
+static const uint8_t *def_fnt8x8, *def_fnt8x14, *def_fnt8x16;
+
+static uint32_t rng_state = 0x12345678;
+
+static uint32_t rng(void) {
+    uint32_t x = rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return rng_state = x;
+}
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Свободное место для блока len байт, не задевающее занятые области
+static int place(uint8_t *used, int size, int len) {
+    for (int tries = 0; tries < 10000; tries++) {
+        int pos = 16 + (int)(rng() % (uint32_t)(size - len - 32));
+        if (!memchr(used + pos, 1, len)) {
+            memset(used + pos, 1, len);
+            return pos;
+        }
+    }
+    return -1;
+}
+
+// Строит линейный синтетический образ и DOS-шрифт к нему
+static void generate_linear(uint8_t *rom, int size, uint8_t *dosfont) {
+    uint8_t *used = calloc(size, 1);
+
+    // "Код" - байты без длинных серий нулей
+    for (int i = 0; i < size; i++) {
+        rom[i] = (uint8_t)(rng() | 1);
+    }
+    rom[0] = 0x55;
+    rom[1] = 0xAA;
+    rom[2] = (uint8_t)(size / 512);
+    memset(used, 1, 16);
+
+    // Таблицы идут подряд в порядке 8x8, 8x14, 8x16 с небольшими
+    // промежутками, как в BIOS настоящих карт
+    const int tables = FONT_8X8_SIZE + FONT_8X14_SIZE + FONT_8X16_SIZE + 3 * 256;
+    int at = 16 + (int)(rng() % (uint32_t)(size - tables - 32));
+    memcpy(rom + at, def_fnt8x8, FONT_8X8_SIZE);
+    at += FONT_8X8_SIZE + rng() % 256;
+    memcpy(rom + at, def_fnt8x14, FONT_8X14_SIZE);
+    at += FONT_8X14_SIZE + rng() % 256;
+    memcpy(rom + at, def_fnt8x16, FONT_8X16_SIZE);
+    at += FONT_8X16_SIZE;
+    memset(used + at - tables, 1, tables + 256);
+
+    // Ложные якоря: серия нулей короче, чем у любой таблицы
+    for (int i = 0; i < DECOYS_PER_32K * (size / 32768); i++) {
+        int pos = place(used, size, 12);
+        if (pos < 0) break;
+        int zeros = rng() % 8;
+        memset(rom + pos + 8 - zeros, 0, zeros);
+        memcpy(rom + pos + 8, "\x7E\x81\xA5\x81", 4);
+    }
+
+    // DOS-шрифт отличается от шрифта ROM в части символов,
+    // и эти глифы DOS-шрифта встречаются в коде
+    memcpy(dosfont, def_fnt8x16, FONT_8X16_SIZE);
+    for (int i = 0; i < CHANGED_GLYPHS; i++) {
+        int ch = 128 + rng() % 128;
+        dosfont[ch * 16 + 4 + rng() % 8] ^= (uint8_t)(1 << (rng() % 8));
+    }
+    for (int i = 0; i < COPIES_PER_32K * (size / 32768); i++) {
+        int pos = place(used, size, 16);
+        if (pos < 0) break;
+        memcpy(rom + pos, dosfont + (128 + rng() % 128) * 16, 16);
+    }
+
+    rom[size - 1] = 0;
+    rom[size - 1] = (uint8_t)(0x100 - byte_sum(rom, size));
+    free(used);
+}
+
+static int make_synthetic(bench_rom_t *r, int size) {
+    uint8_t *linear = malloc(size);
+    r->image = malloc(size);
+    if (!linear || !r->image) {
+        free(linear);
+        return -1;
+    }
+    generate_linear(linear, size, r->dosfont);
+    if (size == 2 * ODD_BANK_OFFSET) {
+        interleave(linear, r->image, size, ODD_BANK_OFFSET);
+        r->flags = 0;
+    } else {
+        memcpy(r->image, linear, size);
+        r->flags = VGAROM_LINEAR;
+    }
+    free(linear);
+    r->size = size;
+    snprintf(r->name, sizeof(r->name), "synthetic-%dK", size / 1024);
+    return 0;
+}
+
+// Реальный образ; DOS-шрифт - его же 8x16 с изменёнными символами
+static int load_image(bench_rom_t *r, const char *path) {
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd == -1 || fstat(fd, &st) != 0) {
+        perror(path);
+        if (fd != -1) close(fd);
+        return -1;
+    }
+    r->size = st.st_size;
+    r->image = malloc(r->size);
+    if (!r->image || read(fd, r->image, r->size) != r->size) {
+        perror(path);
+        close(fd);
+        return -1;
+    }
+    close(fd);
+
+    const char *base = strrchr(path, '/');
+    snprintf(r->name, sizeof(r->name), "%s", base ? base + 1 : path);
+
+    // Образ 32 КБ считается чётно-нечётным, как в firmware_ru, прочие -
+    // линейными (как с ключом -n у fontupdate)
+    vgarom_t rom;
+    r->flags = (r->size == 2 * ODD_BANK_OFFSET) ? 0 : VGAROM_LINEAR;
+    if (vgarom_open_mem(&rom, r->image, r->size, r->flags, NULL) != VGAROM_OK) {
+        fprintf(stderr, "%s: not a VGA ROM\n", path);
+        return -1;
+    }
+    vgarom_locate_fonts(&rom);
+    if (rom.font_offset[VGAROM_FONT_8X16] >= 0) {
+        memcpy(r->dosfont, rom.data + rom.font_offset[VGAROM_FONT_8X16], FONT_8X16_SIZE);
+    } else {
+        memcpy(r->dosfont, def_fnt8x16, FONT_8X16_SIZE);
+    }
+    for (int ch = 128; ch < 128 + CHANGED_GLYPHS; ch++) {
+        r->dosfont[ch * 16 + 8] ^= 0x18;
+    }
+    vgarom_close(&rom);
+    return 0;
+}
+
+static const result_t *find_baseline(const char *image, const char *phase) {
+    for (int i = 0; i < nbaseline; i++) {
+        if (strcmp(baseline[i].image, image) == 0 && strcmp(baseline[i].phase, phase) == 0) {
+            return &baseline[i];
+        }
+    }
+    return NULL;
+}
+
+static void report(const bench_rom_t *r, const char *phase, double secs, long iters, int bytes) {
+    double ns = secs / iters * 1e9;
+    printf("%-24s %-14s %12.0f %10.1f", r->name, phase, ns, bytes / (ns / 1e9) / 1e6);
+
+    const result_t *base = find_baseline(r->name, phase);
+    if (base) {
+        printf(" %+8.1f%%", (ns - base->ns) / base->ns * 100);
+    }
+    printf("\n");
+
+    result_t *p = realloc(results, (nresults + 1) * sizeof(*results));
+    if (p) {
+        results = p;
+        snprintf(results[nresults].image, sizeof(results[nresults].image), "%s", r->name);
+        snprintf(results[nresults].phase, sizeof(results[nresults].phase), "%s", phase);
+        results[nresults].ns = ns;
+        nresults++;
+    }
+}
+
+// Повторяет тело, пока не наберётся MIN_TIME, и выводит результат
+#define MEASURE(r, phase, bytes, body) do { \
+    long iters_ = 0; \
+    double t0_ = now_sec(), t_; \
+    do { \
+        body; \
+        iters_++; \
+    } while ((t_ = now_sec() - t0_) < MIN_TIME); \
+    report(r, phase, t_, iters_, bytes); \
+} while (0)
+
+static void bench_rom(const bench_rom_t *r) {
+    static const uint8_t SIG_8X16[] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x81, 0xA5, 0x81
+    };
+    const int size = r->size;
+    uint8_t *work = malloc(size);
+    uint8_t *out = malloc(size);
+    int max_hits = VGAROM_MAX_DOS_HITS(size);
+    vgarom_dos_hit_t *hits = malloc(max_hits * sizeof(*hits));
+    rom_analysis_t analysis;
+    vgarom_t rom;
+    volatile int sink = 0;
+
+    const int odd_offset = (r->flags & VGAROM_LINEAR) ? 0 : ODD_BANK_OFFSET;
+
+    // Первый проход: перестановка байт, сумма и якоря
+    if (odd_offset) {
+        MEASURE(r, "deinterleave", size, deinterleave(r->image, work, size, odd_offset));
+    }
+    MEASURE(r, "analyze_rom", size, analyze_rom(r->image, work, size, odd_offset, &analysis));
+
+    // Поиск таблиц: одна сигнатура по всему образу и все три по якорям
+    MEASURE(r, "find_signature", size,
+            sink += find_signature(work, size, SIG_8X16, sizeof(SIG_8X16), 0));
+    vgarom_open_mem(&rom, r->image, size, r->flags, work);
+    MEASURE(r, "locate_fonts", size, vgarom_locate_fonts(&rom));
+    font_candidate_t cands[FONT_MAX_CANDIDATES];
+    MEASURE(r, "rank_fonts", size, sink += vgarom_rank_fonts(&rom, cands, FONT_MAX_CANDIDATES));
+    font_pointers_t ptrs;
+    MEASURE(r, "font_pointers", size, sink += find_font_pointers(rom.data, rom.size, &ptrs));
+    int found_8x16 = rom.font_offset[VGAROM_FONT_8X16] >= 0;
+
+    // Поиск паттернов не меняет образ, поэтому меряется отдельно от замены
+    int nhits = 0;
+    MEASURE(r, "dos_patterns", size,
+            nhits = vgarom_find_dos_patterns(&rom, r->dosfont, hits, max_hits, NULL));
+    MEASURE(r, "dos_fuzzy4", size,
+            sink += vgarom_find_dos_patterns_fuzzy(&rom, r->dosfont, 4, hits, max_hits, NULL));
+    MEASURE(r, "replace_font", size, {
+        vgarom_replace_font(&rom, VGAROM_FONT_8X8, def_fnt8x8, FONT_8X8_SIZE);
+        vgarom_replace_font(&rom, VGAROM_FONT_8X14, def_fnt8x14, FONT_8X14_SIZE);
+        vgarom_replace_font(&rom, VGAROM_FONT_8X16, def_fnt8x16, FONT_8X16_SIZE);
+    });
+    // --derive: 8x14 и 8x8 из 8x16
+    MEASURE(r, "derive_fonts", size, {
+        uint8_t derived[FONT_8X14_SIZE];
+        derive_font(def_fnt8x16, 16, derived, 14);
+        derive_font(def_fnt8x16, 16, derived, 8);
+        sink += derived[0];
+    });
+    MEASURE(r, "update_checksum", size, sink += vgarom_update_checksum(&rom));
+    MEASURE(r, "serialize", size, vgarom_serialize(&rom, r->image, out, size, r->flags));
+    vgarom_close(&rom);
+
+    // Весь конвейер в памяти, как в режиме сервера
+    MEASURE(r, "end_to_end", size, {
+        vgarom_open_mem(&rom, r->image, size, r->flags, work);
+        vgarom_locate_fonts(&rom);
+        vgarom_replace_dos_patterns(&rom, r->dosfont, def_fnt8x16, NULL);
+        vgarom_replace_font(&rom, VGAROM_FONT_8X8, def_fnt8x8, FONT_8X8_SIZE);
+        vgarom_replace_font(&rom, VGAROM_FONT_8X14, def_fnt8x14, FONT_8X14_SIZE);
+        vgarom_replace_font(&rom, VGAROM_FONT_8X16, def_fnt8x16, FONT_8X16_SIZE);
+        vgarom_update_checksum(&rom);
+        vgarom_serialize(&rom, r->image, out, size, r->flags);
+        vgarom_close(&rom);
+    });
+
+    if (!found_8x16) {
+        printf("%-24s warning: 8x16 table not found\n", r->name);
+    } else if (byte_sum(out, size) != 0) {
+        printf("%-24s warning: checksum of the result is wrong\n", r->name);
+    }
+    printf("%-24s %d DOS pattern hits\n\n", r->name, nhits);
+
+    free(work);
+    free(out);
+    free(hits);
+}
+
+static int load_baseline(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+    result_t r;
+    while (fscanf(f, "%63s %31s %lf", r.image, r.phase, &r.ns) == 3) {
+        result_t *p = realloc(baseline, (nbaseline + 1) * sizeof(*baseline));
+        if (!p) break;
+        baseline = p;
+        baseline[nbaseline++] = r;
+    }
+    fclose(f);
+    return 0;
+}
+
+static int save_results(const char *path) {
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+    for (int i = 0; i < nresults; i++) {
+        fprintf(f, "%s %s %.1f\n", results[i].image, results[i].phase, results[i].ns);
+    }
+    fclose(f);
+    printf("Baseline saved to %s\n", path);
+    return 0;
+}
+
+static int write_synthetic(int size, const char *path) {
+    bench_rom_t r;
+    if (size < 2 * ODD_BANK_OFFSET || size > (1 << 20) || size % 512 != 0) {
+        fprintf(stderr, "Size must be a multiple of 512 from 32768 to 1048576\n");
+        return 1;
+    }
+    if (make_synthetic(&r, size) != 0) {
+        perror("Memory allocation failed");
+        return 1;
+    }
+    FILE *f = fopen(path, "wb");
+    if (!f || fwrite(r.image, 1, size, f) != (size_t)size) {
+        perror(path);
+        return 1;
+    }
+    fclose(f);
+    free(r.image);
+    printf("Synthetic %d-byte %s ROM written to %s\n", size,
+           (r.flags & VGAROM_LINEAR) ? "linear" : "odd/even", path);
+    return 0;
+}
+
+// Таблицы встроенного шрифта по умолчанию: ими заполняются
+// синтетические образы и заменяются шрифты
+static int load_default_fonts(void) {
+    int idx = fontreg_find(NULL);
+    def_fnt8x8 = fontreg_table(idx, VGAROM_FONT_8X8);
+    def_fnt8x14 = fontreg_table(idx, VGAROM_FONT_8X14);
+    def_fnt8x16 = fontreg_table(idx, VGAROM_FONT_8X16);
+    if (!def_fnt8x8 || !def_fnt8x14 || !def_fnt8x16) {
+        fprintf(stderr, "Error: The default built-in font needs 8x8, 8x14 and 8x16 tables\n");
+        return -1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    static const int synthetic_sizes[] = { 32768, 65536, 262144, 1048576 };
+    const char *save_path = NULL;
+    int argi = 1;
+
+    if (load_default_fonts() != 0) {
+        return 1;
+    }
+    if (argc == 4 && strcmp(argv[1], "--gen") == 0) {
+        return write_synthetic(atoi(argv[2]), argv[3]);
+    }
+    while (argi + 1 < argc && argv[argi][0] == '-') {
+        if (strcmp(argv[argi], "--save") == 0) {
+            save_path = argv[argi + 1];
+        } else if (strcmp(argv[argi], "--compare") == 0) {
+            if (load_baseline(argv[argi + 1]) != 0) return 1;
+        } else {
+            break;
+        }
+        argi += 2;
+    }
+    if (argi < argc && argv[argi][0] == '-') {
+        fprintf(stderr, "Usage: %s [--save <file>] [--compare <file>] [rom ...]\n", argv[0]);
+        fprintf(stderr, "       %s --gen <size> <file>\n", argv[0]);
+        return 1;
+    }
+
+    printf("find_signature: %s, byte order: %s\n\n", find_signature_impl(), interleave_impl());
+    printf("%-24s %-14s %12s %10s%s\n", "image", "phase", "ns/ROM", "MB/s",
+           nbaseline ? "  vs base" : "");
+
+    for (size_t i = 0; i < sizeof(synthetic_sizes) / sizeof(synthetic_sizes[0]); i++) {
+        bench_rom_t r;
+        if (make_synthetic(&r, synthetic_sizes[i]) == 0) {
+            bench_rom(&r);
+            free(r.image);
+        }
+    }
+    for (int i = argi; i < argc; i++) {
+        bench_rom_t r = { .image = NULL };
+        if (load_image(&r, argv[i]) == 0) {
+            bench_rom(&r);
+        }
+        free(r.image);
+    }
+
+    if (save_path && save_results(save_path) != 0) {
+        return 1;
+    }
+    free(results);
+    free(baseline);
+    return 0;
+}
@@ -0,0 +1,163 @@
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "../fontscan.h"
+
+// Микробенчмарк find_signature: цепочка из трёх поисков для каждой
+// реализации и поиск всех таблиц за один проход (locate_fonts)
+// на каждом образе из командной строки
+
+#define ITERATIONS 2000
+
+static const uint8_t SIG_8X8[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x81, 0xA5, 0x81
+};
+static const uint8_t SIG_8X14[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7E, 0x81, 0xA5, 0x81
+};
+static const uint8_t SIG_8X16[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x81, 0xA5, 0x81
+};
+
+typedef int (*find_fn)(const uint8_t *, int, const uint8_t *, int, int);
+
+typedef struct {
+    const char *name;
+    find_fn fn;
+} impl_t;
+
+static void scan_chain(find_fn fn, const uint8_t *data, int size, int offsets[3]) {
+    int start = 0;
+    offsets[0] = fn(data, size, SIG_8X8, sizeof(SIG_8X8), start);
+    if (offsets[0] >= 0) {
+        start = offsets[0] + 2048;
+    }
+    offsets[1] = fn(data, size, SIG_8X14, sizeof(SIG_8X14), start);
+    if (offsets[1] >= 0) {
+        start = offsets[1] + 3584;
+    }
+    offsets[2] = fn(data, size, SIG_8X16, sizeof(SIG_8X16), start);
+}
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint8_t *load_linear(const char *filename, int *size) {
+    struct stat st;
+    if (stat(filename, &st) != 0) {
+        perror(filename);
+        return NULL;
+    }
+    *size = st.st_size;
+
+    uint8_t *raw = malloc(*size);
+    uint8_t *lin = malloc(*size);
+    int fd = open(filename, O_RDONLY);
+    if (!raw || !lin || fd == -1 || read(fd, raw, *size) != *size) {
+        perror(filename);
+        free(raw);
+        free(lin);
+        if (fd != -1) {
+            close(fd);
+        }
+        return NULL;
+    }
+    close(fd);
+
+    // Образы из firmware_ru хранятся в чётно-нечётном порядке
+    for (int i = 0; i < *size; i++) {
+        lin[i] = (i % 2) ? raw[i / 2 + 0x4000] : raw[i / 2];
+    }
+    free(raw);
+    return lin;
+}
+
+int main(int argc, char *argv[]) {
+    impl_t impls[4];
+    int nimpl = 0;
+
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <rom_file>...\n", argv[0]);
+        return 1;
+    }
+
+    impls[nimpl++] = (impl_t){ "scalar", find_signature_scalar };
+#ifdef CPU_X86
+    impls[nimpl++] = (impl_t){ "sse2", find_signature_sse2 };
+    if (cpu_have_avx2()) {
+        impls[nimpl++] = (impl_t){ "avx2", find_signature_avx2 };
+    }
+#endif
+    printf("find_signature dispatch: %s, %d iterations per ROM\n\n", find_signature_impl(), ITERATIONS);
+    printf("%-28s %-7s %10s %10s %8s\n", "ROM", "impl", "ns/chain", "MB/s", "speedup");
+
+    int rc = 0;
+    for (int f = 1; f < argc; f++) {
+        int size;
+        uint8_t *data = load_linear(argv[f], &size);
+        if (!data) {
+            rc = 1;
+            continue;
+        }
+
+        int ref[3];
+        double ref_ns = 0;
+        scan_chain(find_signature_scalar, data, size, ref);
+
+        for (int k = 0; k < nimpl; k++) {
+            int got[3];
+            scan_chain(impls[k].fn, data, size, got);
+            if (memcmp(got, ref, sizeof(ref)) != 0) {
+                fprintf(stderr, "%s: %s gives 0x%X/0x%X/0x%X, scalar 0x%X/0x%X/0x%X\n",
+                        argv[f], impls[k].name, got[0], got[1], got[2], ref[0], ref[1], ref[2]);
+                rc = 1;
+            }
+
+            double t0 = now_sec();
+            for (int it = 0; it < ITERATIONS; it++) {
+                scan_chain(impls[k].fn, data, size, got);
+                __asm__ volatile("" : : "r"(got) : "memory");
+            }
+            double ns = (now_sec() - t0) * 1e9 / ITERATIONS;
+            if (k == 0) {
+                ref_ns = ns;
+            }
+
+            // Объём просмотренных данных: до конца найденного 8x16 или весь образ
+            int scanned = got[2] >= 0 ? got[2] + (int)sizeof(SIG_8X16) : size;
+            const char *name = strrchr(argv[f], '/') ? strrchr(argv[f], '/') + 1 : argv[f];
+            printf("%-28s %-7s %10.0f %10.1f %7.1fx\n", name, impls[k].name, ns,
+                   scanned / ns * 1e9 / (1024 * 1024), ref_ns / ns);
+        }
+
+        // Поиск всех трёх таблиц одним проходом
+        font_layout_t layout;
+        locate_fonts(data, size, &layout);
+        if (layout.offset_8x8 != ref[0] || layout.offset_8x14 != ref[1] || layout.offset_8x16 != ref[2]) {
+            fprintf(stderr, "%s: locate_fonts gives 0x%X/0x%X/0x%X\n", argv[f],
+                    layout.offset_8x8, layout.offset_8x14, layout.offset_8x16);
+            rc = 1;
+        }
+        double t0 = now_sec();
+        for (int it = 0; it < ITERATIONS; it++) {
+            locate_fonts(data, size, &layout);
+            __asm__ volatile("" : : "r"(&layout) : "memory");
+        }
+        double ns = (now_sec() - t0) * 1e9 / ITERATIONS;
+        const char *name = strrchr(argv[f], '/') ? strrchr(argv[f], '/') + 1 : argv[f];
+        printf("%-28s %-7s %10.0f %10.1f %7.1fx\n", name, "locate", ns,
+               size / ns * 1e9 / (1024 * 1024), ref_ns / ns);
+        free(data);
+    }
+    return rc;
+}
@@ -0,0 +1,26 @@
+#ifndef ___CPUDETECT_H___
+#define ___CPUDETECT_H___
+
+// Определение векторных расширений процессора во время работы.
+// На других архитектурах используются только скалярные версии.
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CPU_X86 1
+
+static inline int cpu_have_sse2(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+}
+
+static inline int cpu_have_avx2(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+static inline int cpu_have_popcnt(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("popcnt");
+}
+#endif
+
+#endif // ___CPUDETECT_H___
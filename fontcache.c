@@ -0,0 +1,463 @@
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "fontcache.h"
+#include "fontlib.h"
+#include "fontscan.h"
+
+// Содержимое шрифта, одно на все пути с тем же хешем. Это копия в
+// памяти, а не отображение файла: перезапись файла не должна менять
+// шрифт других путей с тем же содержимым.
+typedef struct {
+    uint8_t *data;      // NULL - слот свободен
+    int size;
+    uint64_t hash;
+    int refs;           // путей с этим содержимым
+} font_blob_t;
+
+// Путь и состояние файла на момент чтения
+typedef struct {
+    char *path;
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    struct timespec mtime;
+    int blob;
+} font_path_t;
+
+// Хеш-таблица номеров путей или блоков: открытая адресация с линейным
+// пробированием, занята не больше чем наполовину. Хеш ключа хранится
+// в ячейке, поэтому при росте таблицы ключи не пересчитываются.
+typedef struct {
+    uint64_t hash;
+    int idx;            // -1 - ячейка пуста
+} index_slot_t;
+
+typedef struct {
+    index_slot_t *slots;
+    unsigned size;      // степень двойки, 0 - таблица не создана
+    int count;
+} index_t;
+
+// Пути ищутся под блокировкой чтения, так что потоки с уже
+// загруженными шрифтами не ждут друг друга. Добавление и замена
+// шрифтов идут под блокировкой записи.
+static pthread_rwlock_t cache_lock = PTHREAD_RWLOCK_INITIALIZER;
+static font_blob_t *blobs = NULL;
+static int nblobs = 0;
+static int *free_blobs = NULL;  // свободные слоты blobs
+static int nfree_blobs = 0;
+static font_path_t *paths = NULL;
+static int npaths = 0;
+static index_t path_index;      // по хешу пути
+static index_t blob_index;      // по хешу содержимого
+static int *retired = NULL;     // блоки без путей, ждут fontcache_collect
+static int nretired = 0;
+static fontcache_stats_t counters;
+static fontlib_t library;
+
+// Попадания по пути считаются и под блокировкой чтения
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+
+#define COUNT(field) do { \
+    pthread_mutex_lock(&stats_lock); \
+    counters.field++; \
+    pthread_mutex_unlock(&stats_lock); \
+} while (0)
+
+uint64_t fontcache_hash(const uint8_t *data, int len) {
+    uint64_t h = 0xCBF29CE484222325ULL;
+    for (int i = 0; i < len; i++) {
+        h = (h ^ data[i]) * 0x100000001B3ULL;
+    }
+    return h;
+}
+
+static uint64_t path_hash(const char *path) {
+    return fontcache_hash((const uint8_t *)path, strlen(path));
+}
+
+static void index_place(index_slot_t *slots, unsigned size, uint64_t hash, int idx) {
+    unsigned i = (unsigned)hash & (size - 1);
+    while (slots[i].idx >= 0) {
+        i = (i + 1) & (size - 1);
+    }
+    slots[i].hash = hash;
+    slots[i].idx = idx;
+}
+
+static int index_add(index_t *t, uint64_t hash, int idx) {
+    if ((unsigned)(t->count + 1) * 2 > t->size) {
+        unsigned size = t->size ? t->size * 2 : 64;
+        index_slot_t *slots = malloc(size * sizeof(*slots));
+        if (!slots) {
+            perror("Memory allocation failed");
+            return -1;
+        }
+        for (unsigned i = 0; i < size; i++) {
+            slots[i].idx = -1;
+        }
+        for (unsigned i = 0; i < t->size; i++) {
+            if (t->slots[i].idx >= 0) {
+                index_place(slots, size, t->slots[i].hash, t->slots[i].idx);
+            }
+        }
+        free(t->slots);
+        t->slots = slots;
+        t->size = size;
+    }
+    index_place(t->slots, t->size, hash, idx);
+    t->count++;
+    return 0;
+}
+
+static void index_clear(index_t *t) {
+    free(t->slots);
+    memset(t, 0, sizeof(*t));
+}
+
+static int same_file(const font_path_t *p, const struct stat *st) {
+    return p->dev == st->st_dev && p->ino == st->st_ino && p->size == st->st_size &&
+           p->mtime.tv_sec == st->st_mtim.tv_sec && p->mtime.tv_nsec == st->st_mtim.tv_nsec;
+}
+
+// Самая маленькая таблица шрифта - 8x8. Более короткий файл не шрифт,
+// и читать из него таблицу вызывающий не должен.
+#define MIN_FONT_SIZE FONT_8X8_SIZE
+
+// Читает открытый файл целиком в память. Возвращает NULL при ошибке.
+static uint8_t *read_font(const char *path, int fd, const struct stat *st) {
+    if (st->st_size < MIN_FONT_SIZE) {
+        fprintf(stderr, "Error: Font file %s is too short (%lld bytes, at least %d expected)\n",
+                path, (long long)st->st_size, MIN_FONT_SIZE);
+        return NULL;
+    }
+    uint8_t *data = malloc(st->st_size);
+    if (!data) {
+        perror("Memory allocation failed");
+        return NULL;
+    }
+    if (pread(fd, data, st->st_size, 0) != st->st_size) {
+        perror("Error reading font file");
+        free(data);
+        return NULL;
+    }
+    return data;
+}
+
+// Блок с тем же содержимым: совпадение хеша подтверждается сравнением
+static int find_blob(const uint8_t *data, int size, uint64_t hash) {
+    const index_t *t = &blob_index;
+    for (unsigned i = (unsigned)hash & (t->size - 1); t->size && t->slots[i].idx >= 0;
+         i = (i + 1) & (t->size - 1)) {
+        const font_blob_t *b = &blobs[t->slots[i].idx];
+        if (t->slots[i].hash == hash && b->size == size && memcmp(b->data, data, size) == 0) {
+            return t->slots[i].idx;
+        }
+    }
+    return -1;
+}
+
+// Находит блок с тем же содержимым или добавляет новый.
+// Возвращает номер блока или -1.
+// Данные переходят кэшу, копия освобождается.
+static int add_blob(uint8_t *data, int size) {
+    uint64_t hash = fontcache_hash(data, size);
+    int slot = find_blob(data, size, hash);
+    if (slot >= 0) {
+        free(data);
+        counters.hash_hits++;
+        return slot;
+    }
+
+    int reused = nfree_blobs > 0;
+    if (reused) {
+        slot = free_blobs[--nfree_blobs];
+    } else {
+        font_blob_t *p = realloc(blobs, (nblobs + 1) * sizeof(*blobs));
+        if (!p) {
+            perror("Memory allocation failed");
+            free(data);
+            return -1;
+        }
+        blobs = p;
+        slot = nblobs++;
+    }
+    if (index_add(&blob_index, hash, slot) != 0) {
+        blobs[slot].data = NULL;
+        if (reused) {
+            nfree_blobs++;
+        } else {
+            nblobs--;
+        }
+        free(data);
+        return -1;
+    }
+    blobs[slot].data = data;
+    blobs[slot].size = size;
+    blobs[slot].hash = hash;
+    blobs[slot].refs = 0;
+    counters.misses++;
+    counters.fonts++;
+    counters.bytes += size;
+    return slot;
+}
+
+// Путь перестал ссылаться на блок. Память блока без путей освобождает
+// fontcache_collect: указатель на него ещё может использовать другой
+// поток. До этого блок можно снова найти по содержимому.
+static void drop_blob(int blob) {
+    if (--blobs[blob].refs > 0) {
+        return;
+    }
+    int *p = realloc(retired, (nretired + 1) * sizeof(*retired));
+    if (!p) {
+        return;     // блок останется до fontcache_clear
+    }
+    retired = p;
+    retired[nretired++] = blob;
+}
+
+static font_path_t *find_path(const char *path, uint64_t hash) {
+    const index_t *t = &path_index;
+    for (unsigned i = (unsigned)hash & (t->size - 1); t->size && t->slots[i].idx >= 0;
+         i = (i + 1) & (t->size - 1)) {
+        if (t->slots[i].hash == hash && strcmp(paths[t->slots[i].idx].path, path) == 0) {
+            return &paths[t->slots[i].idx];
+        }
+    }
+    return NULL;
+}
+
+// Добавляет путь с уже найденным содержимым
+static int add_path(const char *path, uint64_t hash, int blob) {
+    font_path_t *p = realloc(paths, (npaths + 1) * sizeof(*paths));
+    char *path_copy = strdup(path);
+    if (!p || !path_copy) {
+        perror("Memory allocation failed");
+        if (p) paths = p;
+        free(path_copy);
+        return -1;
+    }
+    paths = p;
+    if (index_add(&path_index, hash, npaths) != 0) {
+        free(path_copy);
+        return -1;
+    }
+    memset(&paths[npaths], 0, sizeof(*paths));
+    paths[npaths].path = path_copy;
+    paths[npaths].blob = blob;
+    blobs[blob].refs++;
+    npaths++;
+    return 0;
+}
+
+// Путь уже в кэше, и файл не менялся (st == NULL - шрифт библиотеки).
+// Ничего не меняет, поэтому вызывается под блокировкой чтения.
+static const uint8_t *lookup(const char *path, uint64_t hash, const struct stat *st, int *size) {
+    const font_path_t *entry = find_path(path, hash);
+    if (!entry || (st && !same_file(entry, st))) {
+        return NULL;
+    }
+    *size = blobs[entry->blob].size;
+    return blobs[entry->blob].data;
+}
+
+// Шрифт "@имя" из библиотеки: таблица собирается из глифов один раз
+// и дальше находится по имени, как файл по пути
+static const uint8_t *library_get(const char *path, uint64_t hash, int *size) {
+    const uint8_t *cached = lookup(path, hash, NULL, size);
+    if (cached) {
+        COUNT(path_hits);
+        return cached;
+    }
+
+    fontlib_font_t font;
+    int err = library.data ? fontlib_find(&library, path + 1, &font) : FONTLIB_ERR_NOT_FOUND;
+    if (err != FONTLIB_OK) {
+        fprintf(stderr, "Error: Font %s: %s\n", path,
+                library.data ? fontlib_strerror(err) : "No font library is open");
+        return NULL;
+    }
+    int font_size = font.nchars * font.height;
+    if (font_size < MIN_FONT_SIZE) {
+        fprintf(stderr, "Error: Font %s is too short (%d bytes, at least %d expected)\n",
+                path, font_size, MIN_FONT_SIZE);
+        return NULL;
+    }
+    uint8_t *data = malloc(font_size);
+    if (!data) {
+        perror("Memory allocation failed");
+        return NULL;
+    }
+    fontlib_copy(&font, data);
+    int blob = add_blob(data, font_size);
+    if (blob < 0 || add_path(path, hash, blob) != 0) {
+        return NULL;
+    }
+    *size = blobs[blob].size;
+    return blobs[blob].data;
+}
+
+static const uint8_t *cache_get(const char *path, uint64_t hash, int *size) {
+    if (path[0] == '@') {
+        return library_get(path, hash, size);
+    }
+
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        perror("Error getting font file size");
+        return NULL;
+    }
+
+    font_path_t *entry = find_path(path, hash);
+    if (entry && same_file(entry, &st)) {
+        COUNT(path_hits);
+        *size = blobs[entry->blob].size;
+        return blobs[entry->blob].data;
+    }
+
+    // Новый путь или файл изменился с прошлого чтения.
+    // Путь без прочитанного содержимого в кэш не попадает.
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) {
+        perror("Error opening font file");
+        return NULL;
+    }
+    uint8_t *data = fstat(fd, &st) == 0 ? read_font(path, fd, &st) : NULL;
+    close(fd);
+    int blob = data ? add_blob(data, st.st_size) : -1;
+    if (blob < 0) {
+        return NULL;
+    }
+    if (!entry) {
+        if (add_path(path, hash, blob) != 0) {
+            return NULL;
+        }
+        entry = &paths[npaths - 1];
+    } else if (entry->blob != blob) {
+        blobs[blob].refs++;
+        drop_blob(entry->blob);
+    }
+    entry->dev = st.st_dev;
+    entry->ino = st.st_ino;
+    entry->size = st.st_size;
+    entry->mtime = st.st_mtim;
+    entry->blob = blob;
+
+    *size = blobs[blob].size;
+    return blobs[blob].data;
+}
+
+const uint8_t *fontcache_get(const char *path, int *size) {
+    uint64_t hash = path_hash(path);
+    const uint8_t *data = NULL;
+
+    // Файл не изменился - хватает блокировки чтения. stat делается
+    // до неё, чтобы системный вызов не задерживал другие потоки.
+    struct stat st;
+    int library_font = path[0] == '@';
+    if (library_font || stat(path, &st) == 0) {
+        pthread_rwlock_rdlock(&cache_lock);
+        data = lookup(path, hash, library_font ? NULL : &st, size);
+        pthread_rwlock_unlock(&cache_lock);
+    }
+    if (data) {
+        COUNT(path_hits);
+        return data;
+    }
+
+    pthread_rwlock_wrlock(&cache_lock);
+    data = cache_get(path, hash, size);
+    pthread_rwlock_unlock(&cache_lock);
+    return data;
+}
+
+void fontcache_stats(fontcache_stats_t *stats) {
+    pthread_rwlock_rdlock(&cache_lock);
+    pthread_mutex_lock(&stats_lock);
+    *stats = counters;
+    pthread_mutex_unlock(&stats_lock);
+    pthread_rwlock_unlock(&cache_lock);
+}
+
+void fontcache_collect(void) {
+    int freed = 0;
+
+    pthread_rwlock_wrlock(&cache_lock);
+    for (int i = 0; i < nretired; i++) {
+        font_blob_t *b = &blobs[retired[i]];
+        if (b->refs == 0 && b->data) {
+            counters.fonts--;
+            counters.bytes -= b->size;
+            free(b->data);
+            b->data = NULL;
+            freed++;
+        }
+    }
+    free(retired);
+    retired = NULL;
+    nretired = 0;
+
+    // Из таблицы с открытой адресацией ключи не удаляются: она
+    // перестраивается по оставшимся блокам, а освободившиеся слоты
+    // идут в список свободных
+    if (freed > 0) {
+        int *p = realloc(free_blobs, nblobs * sizeof(*free_blobs));
+        if (p) {
+            free_blobs = p;
+        }
+        index_clear(&blob_index);
+        nfree_blobs = 0;
+        for (int i = 0; i < nblobs; i++) {
+            if (blobs[i].data) {
+                index_add(&blob_index, blobs[i].hash, i);
+            } else if (p) {
+                free_blobs[nfree_blobs++] = i;
+            }
+        }
+    }
+    pthread_rwlock_unlock(&cache_lock);
+}
+
+void fontcache_clear(void) {
+    pthread_rwlock_wrlock(&cache_lock);
+    for (int i = 0; i < nblobs; i++) {
+        free(blobs[i].data);
+    }
+    for (int i = 0; i < npaths; i++) {
+        free(paths[i].path);
+    }
+    free(blobs);
+    free(paths);
+    free(retired);
+    free(free_blobs);
+    blobs = NULL;
+    paths = NULL;
+    retired = NULL;
+    free_blobs = NULL;
+    nblobs = npaths = nretired = nfree_blobs = 0;
+    index_clear(&path_index);
+    index_clear(&blob_index);
+    pthread_mutex_lock(&stats_lock);
+    memset(&counters, 0, sizeof(counters));
+    pthread_mutex_unlock(&stats_lock);
+    fontlib_close(&library);
+    pthread_rwlock_unlock(&cache_lock);
+}
+
+int fontcache_open_library(const char *path) {
+    pthread_rwlock_wrlock(&cache_lock);
+    fontlib_close(&library);
+    int err = fontlib_open(&library, path);
+    pthread_rwlock_unlock(&cache_lock);
+    if (err != FONTLIB_OK) {
+        fprintf(stderr, "Error opening font library %s: %s\n", path, fontlib_strerror(err));
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,45 @@
+#ifndef ___FONTCACHE_H___
+#define ___FONTCACHE_H___
+
+#include <stdint.h>
+
+// Кэш файлов шрифтов на время работы программы. Файл ищется по пути,
+// устройству, inode, размеру и времени изменения; новый или изменённый
+// файл читается в память, и если такое же содержимое уже есть в кэше
+// (по хешу), используется имеющаяся копия. Файл после чтения не
+// используется, так что его перезапись не меняет загруженные шрифты.
+// Функции можно вызывать из нескольких потоков.
+//
+// Путь вида "@имя" - шрифт из библиотеки (fontlib.h), открытой
+// fontcache_open_library: файловая система при этом не затрагивается.
+
+typedef struct {
+    int path_hits;      // найдено по пути без чтения файла
+    int hash_hits;      // файл прочитан, но содержимое уже было в кэше
+    int misses;         // новое содержимое
+    int fonts;          // различных шрифтов в кэше
+    long bytes;         // их общий размер
+} fontcache_stats_t;
+
+// Шрифты короче таблицы 8x8 (FONT_8X8_SIZE) не загружаются.
+// Возвращает содержимое шрифта (только для чтения, живёт до
+// fontcache_collect после изменения файла или до fontcache_clear)
+// и его размер в *size или NULL при ошибке
+const uint8_t *fontcache_get(const char *path, int *size);
+
+// Освобождает прежнее содержимое изменившихся файлов. Вызывается,
+// когда ни один указатель от fontcache_get не используется.
+void fontcache_collect(void);
+
+void fontcache_stats(fontcache_stats_t *stats);
+
+// Открывает библиотеку шрифтов для путей "@имя"
+int fontcache_open_library(const char *path);
+
+// Освобождает все шрифты кэша и закрывает библиотеку
+void fontcache_clear(void);
+
+// 64-битный хеш FNV-1a содержимого
+uint64_t fontcache_hash(const uint8_t *data, int len);
+
+#endif // ___FONTCACHE_H___
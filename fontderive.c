@@ -0,0 +1,183 @@
+#include <string.h>
+#include "fontderive.h"
+
+#ifdef CPU_X86
+#include <immintrin.h>
+#endif
+
+// Число отличающихся бит двух строк по всем глифам
+static long pair_cost(const uint8_t *a, const uint8_t *b) {
+    long cost = 0;
+    for (int g = 0; g < DERIVE_GLYPHS; g++) {
+        cost += __builtin_popcount(a[g] ^ b[g]);
+    }
+    return cost;
+}
+
+int derive_plan(const uint8_t *font, int src_height, int dst_height, derive_map_t *map) {
+    // Строки по группам вдоль всех глифов: rows[row[j]][g] - OR строк
+    // группы j глифа g; слияние групп - OR двух строк по 256 байт
+    uint8_t rows[DERIVE_MAX_HEIGHT][DERIVE_GLYPHS];
+    int row[DERIVE_MAX_HEIGHT];
+    long cost[DERIVE_MAX_HEIGHT];
+    int ngroups = src_height;
+
+    if (src_height < 1 || src_height > DERIVE_MAX_HEIGHT ||
+        dst_height < 1 || dst_height > src_height) {
+        return -1;
+    }
+    map->src_height = src_height;
+    map->dst_height = dst_height;
+    for (int j = 0; j <= src_height; j++) {
+        map->start[j] = j;
+    }
+    for (int g = 0; g < DERIVE_GLYPHS; g++) {
+        for (int j = 0; j < src_height; j++) {
+            rows[j][g] = font[g * src_height + j];
+        }
+    }
+    for (int j = 0; j < src_height; j++) {
+        row[j] = j;
+    }
+    // cost[j] - цена слияния групп j и j + 1
+    for (int j = 0; j + 1 < src_height; j++) {
+        cost[j] = pair_cost(rows[j], rows[j + 1]);
+    }
+
+    while (ngroups > dst_height) {
+        // При равной цене сливается верхняя пара
+        int best = 0;
+        for (int j = 1; j + 1 < ngroups; j++) {
+            if (cost[j] < cost[best]) {
+                best = j;
+            }
+        }
+
+        uint8_t *merged = rows[row[best]];
+        const uint8_t *next = rows[row[best + 1]];
+        for (int g = 0; g < DERIVE_GLYPHS; g++) {
+            merged[g] |= next[g];
+        }
+        memmove(row + best + 1, row + best + 2, (ngroups - best - 2) * sizeof(*row));
+        if (best + 2 < ngroups - 1) {
+            memmove(cost + best + 1, cost + best + 2, (ngroups - best - 3) * sizeof(*cost));
+        }
+        memmove(map->start + best + 1, map->start + best + 2, ngroups - best - 1);
+        ngroups--;
+
+        // Изменились только пары с новой группой
+        if (best > 0) {
+            cost[best - 1] = pair_cost(rows[row[best - 1]], merged);
+        }
+        if (best + 1 < ngroups) {
+            cost[best] = pair_cost(merged, rows[row[best + 1]]);
+        }
+    }
+    return 0;
+}
+
+void derive_apply_scalar(const uint8_t *font, const derive_map_t *map, uint8_t *out) {
+    for (int g = 0; g < DERIVE_GLYPHS; g++) {
+        const uint8_t *src = font + g * map->src_height;
+        uint8_t *dst = out + g * map->dst_height;
+        for (int i = 0; i < map->dst_height; i++) {
+            uint8_t row = 0;
+            for (int j = map->start[i]; j < map->start[i + 1]; j++) {
+                row |= src[j];
+            }
+            dst[i] = row;
+        }
+    }
+}
+
+#ifdef CPU_X86
+// Глиф до 16 строк целиком в половине регистра, по два глифа за шаг.
+// Группа из k строк собирается k перестановками pshufb: перестановка
+// m берёт m-ю строку группы (или последнюю, если группа короче), строки
+// за dst_height обнуляются. Запись по 16 байт внахлёст: хвост глифа
+// перекрывается следующим.
+__attribute__((target("avx2")))
+void derive_apply_avx2(const uint8_t *font, const derive_map_t *map, uint8_t *out) {
+    const int sh = map->src_height, dh = map->dst_height;
+    if (sh > 16) {
+        derive_apply_scalar(font, map, out);
+        return;
+    }
+
+    int maxlen = 0;
+    for (int i = 0; i < dh; i++) {
+        int len = map->start[i + 1] - map->start[i];
+        maxlen = len > maxlen ? len : maxlen;
+    }
+    __m256i shuf[16];
+    for (int m = 0; m < maxlen; m++) {
+        uint8_t idx[16];
+        for (int i = 0; i < 16; i++) {
+            if (i >= dh) {
+                idx[i] = 0x80;
+            } else {
+                int last = map->start[i + 1] - 1;
+                int j = map->start[i] + m;
+                idx[i] = j < last ? j : last;
+            }
+        }
+        shuf[m] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)idx));
+    }
+
+    // Загрузка и запись 16 байт не выходят за таблицы
+    int g = 0;
+    for (; g + 1 < DERIVE_GLYPHS && (g + 1) * sh + 16 <= DERIVE_GLYPHS * sh &&
+           (g + 1) * dh + 16 <= DERIVE_GLYPHS * dh; g += 2) {
+        __m256i v = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(font + g * sh))),
+            _mm_loadu_si128((const __m128i *)(font + (g + 1) * sh)), 1);
+        __m256i r = _mm256_shuffle_epi8(v, shuf[0]);
+        for (int m = 1; m < maxlen; m++) {
+            r = _mm256_or_si256(r, _mm256_shuffle_epi8(v, shuf[m]));
+        }
+        _mm_storeu_si128((__m128i *)(out + g * dh), _mm256_castsi256_si128(r));
+        _mm_storeu_si128((__m128i *)(out + (g + 1) * dh), _mm256_extracti128_si256(r, 1));
+    }
+
+    // Последние глифы - скалярно
+    for (; g < DERIVE_GLYPHS; g++) {
+        const uint8_t *src = font + g * sh;
+        for (int i = 0; i < dh; i++) {
+            uint8_t row = 0;
+            for (int j = map->start[i]; j < map->start[i + 1]; j++) {
+                row |= src[j];
+            }
+            out[g * dh + i] = row;
+        }
+    }
+}
+#endif // CPU_X86
+
+void derive_apply(const uint8_t *font, const derive_map_t *map, uint8_t *out) {
+#ifdef CPU_X86
+    if (map->src_height <= 16 && cpu_have_avx2()) {
+        derive_apply_avx2(font, map, out);
+        return;
+    }
+#endif
+    derive_apply_scalar(font, map, out);
+}
+
+const char *derive_impl(void) {
+#ifdef CPU_X86
+    if (cpu_have_avx2()) {
+        return "avx2";
+    }
+#endif
+    return "scalar";
+}
+
+int derive_font(const uint8_t *font, int src_height, uint8_t *out, int dst_height) {
+    derive_map_t map;
+
+    if (derive_plan(font, src_height, dst_height, &map) != 0) {
+        return -1;
+    }
+    derive_apply(font, &map, out);
+    return 0;
+}
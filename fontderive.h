@@ -0,0 +1,46 @@
+#ifndef ___FONTDERIVE_H___
+#define ___FONTDERIVE_H___
+
+#include <stdint.h>
+#include "cpudetect.h"
+
+// Построение шрифта меньшей высоты (8x14, 8x8) из 8x16 слиянием
+// соседних строк глифа: строка результата - OR группы подряд идущих
+// строк источника. Группы общие для всех 256 глифов, чтобы базовая
+// линия и высота букв совпадали у всего шрифта, и выбираются по самому
+// шрифту: жадно сливается пара соседних групп, которая меньше всего
+// различается по всем глифам (обычно пустые строки сверху и снизу и
+// середины вертикальных штрихов). Результат зависит только от шрифта.
+
+#define DERIVE_MAX_HEIGHT 32
+#define DERIVE_GLYPHS 256
+
+// Разбиение строк источника на группы: строка i результата - OR строк
+// источника start[i] .. start[i + 1] - 1
+typedef struct {
+    int src_height;
+    int dst_height;
+    uint8_t start[DERIVE_MAX_HEIGHT + 1];
+} derive_map_t;
+
+// Выбирает группы для шрифта font (256 глифов по src_height байт).
+// Требуется 1 <= dst_height <= src_height <= DERIVE_MAX_HEIGHT.
+int derive_plan(const uint8_t *font, int src_height, int dst_height, derive_map_t *map);
+
+// Строит 256 глифов по map в out (256 * dst_height байт).
+// Реализация (AVX2 для источника до 16 строк или скалярная)
+// выбирается во время работы.
+void derive_apply(const uint8_t *font, const derive_map_t *map, uint8_t *out);
+void derive_apply_scalar(const uint8_t *font, const derive_map_t *map, uint8_t *out);
+
+#ifdef CPU_X86
+void derive_apply_avx2(const uint8_t *font, const derive_map_t *map, uint8_t *out);
+#endif
+
+// Название реализации, которую выбирает derive_apply
+const char *derive_impl(void);
+
+// derive_plan и derive_apply вместе. Возвращает 0 или -1 при неверной высоте.
+int derive_font(const uint8_t *font, int src_height, uint8_t *out, int dst_height);
+
+#endif // ___FONTDERIVE_H___
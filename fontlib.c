@@ -0,0 +1,154 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "fontlib.h"
+
+uint32_t fontlib_hash(const char *name) {
+    uint32_t h = 0x811C9DC5;
+    for (; *name; name++) {
+        h = (h ^ (uint8_t)*name) * 0x01000193;
+    }
+    return h;
+}
+
+// Область [offset, offset + len) внутри файла
+static int in_file(const fontlib_t *lib, uint64_t offset, uint64_t len) {
+    return offset <= lib->size && len <= lib->size - offset;
+}
+
+int fontlib_open(fontlib_t *lib, const char *path) {
+    struct stat st;
+
+    memset(lib, 0, sizeof(*lib));
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) {
+        return FONTLIB_ERR_IO;
+    }
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return FONTLIB_ERR_IO;
+    }
+    if ((size_t)st.st_size < sizeof(fontlib_header_t)) {
+        close(fd);
+        return FONTLIB_ERR_FORMAT;
+    }
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    int saved_errno = errno;
+    close(fd);
+    if (data == MAP_FAILED) {
+        errno = saved_errno;
+        return FONTLIB_ERR_IO;
+    }
+    lib->data = data;
+    lib->size = st.st_size;
+    lib->hdr = data;
+
+    // Таблицы проверяются целиком здесь, записи шрифтов - при поиске
+    const fontlib_header_t *hdr = lib->hdr;
+    if (memcmp(hdr->magic, FONTLIB_MAGIC, sizeof(hdr->magic)) != 0 ||
+        hdr->size != lib->size || hdr->nbuckets == 0 ||
+        (hdr->nbuckets & (hdr->nbuckets - 1)) != 0 || hdr->nfonts >= hdr->nbuckets ||
+        hdr->buckets % 4 != 0 || hdr->fonts % 4 != 0 ||
+        !in_file(lib, hdr->buckets, (uint64_t)hdr->nbuckets * sizeof(uint32_t)) ||
+        !in_file(lib, hdr->fonts, (uint64_t)hdr->nfonts * sizeof(fontlib_rec_t))) {
+        fontlib_close(lib);
+        return FONTLIB_ERR_FORMAT;
+    }
+    return FONTLIB_OK;
+}
+
+void fontlib_close(fontlib_t *lib) {
+    if (lib->data) {
+        munmap((void *)lib->data, lib->size);
+    }
+    memset(lib, 0, sizeof(*lib));
+}
+
+// Проверка записи шрифта: имя и все глифы лежат внутри файла
+static int check_rec(const fontlib_t *lib, const fontlib_rec_t *rec) {
+    if (rec->name >= lib->size ||
+        !memchr(lib->data + rec->name, '\0', lib->size - rec->name) ||
+        rec->height == 0 || rec->glyphs % 4 != 0 ||
+        !in_file(lib, rec->glyphs, (uint64_t)rec->nchars * sizeof(uint32_t))) {
+        return FONTLIB_ERR_FORMAT;
+    }
+    const uint32_t *glyphs = (const uint32_t *)(lib->data + rec->glyphs);
+    for (int c = 0; c < rec->nchars; c++) {
+        if (!in_file(lib, glyphs[c], rec->height)) {
+            return FONTLIB_ERR_FORMAT;
+        }
+    }
+    return FONTLIB_OK;
+}
+
+static void fill_font(const fontlib_t *lib, const fontlib_rec_t *rec, fontlib_font_t *font) {
+    font->name = (const char *)lib->data + rec->name;
+    font->height = rec->height;
+    font->nchars = rec->nchars;
+    font->data = lib->data;
+    font->glyphs = (const uint32_t *)(lib->data + rec->glyphs);
+}
+
+int fontlib_font(const fontlib_t *lib, int idx, fontlib_font_t *font) {
+    if (idx < 0 || (uint32_t)idx >= lib->hdr->nfonts) {
+        return FONTLIB_ERR_NOT_FOUND;
+    }
+    const fontlib_rec_t *rec = (const fontlib_rec_t *)(lib->data + lib->hdr->fonts) + idx;
+    if (check_rec(lib, rec) != FONTLIB_OK) {
+        return FONTLIB_ERR_FORMAT;
+    }
+    fill_font(lib, rec, font);
+    return FONTLIB_OK;
+}
+
+int fontlib_find(const fontlib_t *lib, const char *name, fontlib_font_t *font) {
+    const fontlib_header_t *hdr = lib->hdr;
+    const uint32_t *buckets = (const uint32_t *)(lib->data + hdr->buckets);
+    const fontlib_rec_t *recs = (const fontlib_rec_t *)(lib->data + hdr->fonts);
+    uint32_t hash = fontlib_hash(name);
+    uint32_t mask = hdr->nbuckets - 1;
+
+    // В исправном файле свободная ячейка есть всегда (nfonts < nbuckets),
+    // но число проб ограничено и для повреждённого
+    uint32_t i = hash & mask;
+    for (uint32_t probe = 0; probe < hdr->nbuckets && buckets[i] != 0; probe++, i = (i + 1) & mask) {
+        if (buckets[i] > hdr->nfonts) {
+            return FONTLIB_ERR_FORMAT;
+        }
+        const fontlib_rec_t *rec = &recs[buckets[i] - 1];
+        if (rec->hash != hash) {
+            continue;
+        }
+        if (check_rec(lib, rec) != FONTLIB_OK) {
+            return FONTLIB_ERR_FORMAT;
+        }
+        if (strcmp((const char *)lib->data + rec->name, name) == 0) {
+            fill_font(lib, rec, font);
+            return FONTLIB_OK;
+        }
+    }
+    return FONTLIB_ERR_NOT_FOUND;
+}
+
+const uint8_t *fontlib_glyph(const fontlib_font_t *font, int c) {
+    return font->data + font->glyphs[c];
+}
+
+void fontlib_copy(const fontlib_font_t *font, uint8_t *table) {
+    for (int c = 0; c < font->nchars; c++) {
+        memcpy(table + c * font->height, fontlib_glyph(font, c), font->height);
+    }
+}
+
+const char *fontlib_strerror(int err) {
+    switch (err) {
+        case FONTLIB_OK:            return "Success";
+        case FONTLIB_ERR_IO:        return strerror(errno);
+        case FONTLIB_ERR_FORMAT:    return "Not a font library or the library is corrupted";
+        case FONTLIB_ERR_NOT_FOUND: return "Font not found in the library";
+        default:                    return "Unknown error";
+    }
+}
@@ -0,0 +1,84 @@
+#ifndef ___FONTLIB_H___
+#define ___FONTLIB_H___
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Библиотека шрифтов: много шрифтов в одном файле, который отображается
+// в память и читается без копирования. Шрифт ищется по имени через
+// хеш-таблицу; одинаковые глифы разных шрифтов хранятся один раз.
+// Файл собирает utils/fontpack из каталога со шрифтами.
+//
+// Формат (целые little-endian, смещения от начала файла):
+//   fontlib_header_t
+//   uint32_t[nbuckets]      - номер шрифта + 1 или 0 (свободно),
+//                             открытая адресация с линейным пробированием
+//   fontlib_rec_t[nfonts]
+//   имена шрифтов           - строки с нулём
+//   uint32_t[nchars]        - для каждого шрифта смещения его глифов
+//   глифы                   - по height байт
+
+#define FONTLIB_MAGIC "VGAFLIB1"
+
+#define FONTLIB_OK              0
+#define FONTLIB_ERR_IO         -1   // ошибка открытия или чтения, см. errno
+#define FONTLIB_ERR_FORMAT     -2   // не библиотека шрифтов или файл повреждён
+#define FONTLIB_ERR_NOT_FOUND  -3   // шрифта с таким именем нет
+
+typedef struct {
+    char magic[8];
+    uint32_t nfonts;
+    uint32_t nbuckets;      // степень двойки
+    uint32_t buckets;       // смещение хеш-таблицы имён
+    uint32_t fonts;         // смещение записей шрифтов
+    uint32_t size;          // размер файла
+    uint32_t reserved;
+} fontlib_header_t;
+
+typedef struct {
+    uint32_t name;          // смещение имени
+    uint32_t hash;          // fontlib_hash(имя)
+    uint16_t height;        // байт на глиф
+    uint16_t nchars;        // глифов в шрифте
+    uint32_t glyphs;        // смещение таблицы смещений глифов
+} fontlib_rec_t;
+
+// Открытая библиотека
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    const fontlib_header_t *hdr;
+} fontlib_t;
+
+// Шрифт библиотеки; указатели ведут в отображённый файл
+typedef struct {
+    const char *name;
+    int height;
+    int nchars;
+    const uint8_t *data;        // начало файла
+    const uint32_t *glyphs;
+} fontlib_font_t;
+
+// Отображает файл библиотеки в память и проверяет заголовок
+int fontlib_open(fontlib_t *lib, const char *path);
+void fontlib_close(fontlib_t *lib);
+
+// Поиск шрифта по имени
+int fontlib_find(const fontlib_t *lib, const char *name, fontlib_font_t *font);
+
+// Шрифт с номером idx (0 .. nfonts - 1), например для списка шрифтов
+int fontlib_font(const fontlib_t *lib, int idx, fontlib_font_t *font);
+
+// Глиф символа c (height байт) без копирования
+const uint8_t *fontlib_glyph(const fontlib_font_t *font, int c);
+
+// Собирает шрифт в непрерывную таблицу nchars * height байт
+void fontlib_copy(const fontlib_font_t *font, uint8_t *table);
+
+// 32-битный хеш FNV-1a имени шрифта
+uint32_t fontlib_hash(const char *name);
+
+// Описание кода ошибки
+const char *fontlib_strerror(int err);
+
+#endif // ___FONTLIB_H___
@@ -0,0 +1,218 @@
+#include <stdlib.h>
+#include <string.h>
+#include "fontptr.h"
+#include "fontscan.h"
+#include "rmemu.h"
+
+#define ENTRY_POINT 3           // после 55 AA и длины образа
+#define INT10_VECTOR 0x40       // адрес вектора 10h
+#define MAX_HANDLERS 16
+#define MAX_STEPS 20000         // на один вызов 1130h
+#define MAX_ALT_RECORDS 256
+
+// Обход кода от точки входа. Кандидаты в обработчик INT 10h - адреса,
+// которые код записывает в вектор 10h:
+//   mov di,0040h / mov ax,<обработчик> / call <запись вектора>
+//   mov word [0040h],<обработчик>
+//   mov ax,<обработчик> / mov [0040h],ax
+typedef struct {
+    const uint8_t *data;
+    int len;
+    uint8_t *seen;              // 1 - адрес уже поставлен в очередь
+    int *queue;                 // обход в ширину: код инициализации
+    int head, nqueue;           // разбирается раньше вложенных подпрограмм
+    int handlers[MAX_HANDLERS];
+    int nhandlers;
+} walk_t;
+
+static void add_target(walk_t *w, int pos) {
+    if (pos >= 0 && pos < w->len && !w->seen[pos]) {
+        w->seen[pos] = 1;
+        w->queue[w->nqueue++] = pos;
+    }
+}
+
+static void add_handler(walk_t *w, int value) {
+    if (value < 0 || value >= w->len || w->nhandlers == MAX_HANDLERS) {
+        return;
+    }
+    for (int i = 0; i < w->nhandlers; i++) {
+        if (w->handlers[i] == value) {
+            return;
+        }
+    }
+    w->handlers[w->nhandlers++] = value;
+}
+
+// Разбирает команды от pos до безусловного перехода или возврата.
+// imm[r] - значение, загруженное в регистр r командой mov r16,imm16
+// в этом же блоке, -1 - неизвестно.
+static void walk_block(walk_t *w, int pos) {
+    int imm[8];
+    for (int r = 0; r < 8; r++) {
+        imm[r] = -1;
+    }
+
+    for (;;) {
+        rmemu_insn_t insn;
+        if (rmemu_decode(w->data + pos, w->len - pos, &insn) < 0) {
+            return;
+        }
+        int next = pos + insn.len;
+        uint8_t op = insn.op;
+        int direct = insn.has_modrm && insn.mod == 0 && insn.rm == 6;
+
+        if (op >= 0xB8 && op <= 0xBF) {
+            for (int r = 0; r < 8; r++) {
+                if (r != (op & 7) && imm[r] == INT10_VECTOR) {
+                    add_handler(w, insn.imm);
+                }
+            }
+            imm[op & 7] = insn.imm;
+        } else if (op == 0xC7 && insn.mod != 3) {
+            // mov word [0040h],imm или mov word [di],imm при di = 0040h
+            int reg = insn.mod == 0 ? (insn.rm == 4 ? RMEMU_SI : insn.rm == 5 ? RMEMU_DI :
+                                       insn.rm == 7 ? RMEMU_BX : -1) : -1;
+            if ((direct && insn.disp == INT10_VECTOR) || (reg >= 0 && imm[reg] == INT10_VECTOR)) {
+                add_handler(w, insn.imm);
+            }
+        } else if (op == 0xA3 && insn.disp == INT10_VECTOR && imm[RMEMU_AX] >= 0) {
+            add_handler(w, imm[RMEMU_AX]);
+        } else if (op == 0x89 && direct && insn.disp == INT10_VECTOR && imm[insn.reg] >= 0) {
+            add_handler(w, imm[insn.reg]);
+        }
+
+        if ((op >= 0x70 && op <= 0x7F) || (op >= 0xE0 && op <= 0xE3)) {
+            add_target(w, next + (int8_t)insn.imm);
+        } else if (op == 0xEB) {
+            add_target(w, next + (int8_t)insn.imm);
+            return;
+        } else if (op == 0xE9) {
+            add_target(w, (uint16_t)(next + insn.imm));
+            return;
+        } else if (op == 0xE8) {
+            add_target(w, (uint16_t)(next + insn.imm));
+            for (int r = 0; r < 8; r++) {
+                imm[r] = -1;
+            }
+        } else if (op == 0xC2 || op == 0xC3 || op == 0xCA || op == 0xCB || op == 0xCF ||
+                   op == 0xEA || op == 0xF4 ||
+                   (op == 0xFF && (insn.reg == 4 || insn.reg == 5))) {
+            return;
+        }
+
+        // Следующая команда уже разобрана другим путём
+        if (next >= w->len || w->seen[next]) {
+            return;
+        }
+        w->seen[next] = 1;
+        pos = next;
+    }
+}
+
+// Вызов INT 10h AX=1130h, BH=bh. Возвращает смещение ES:BP в образе
+// или -1.
+static int get_font_pointer(rmemu_t *cpu, int handler, int bh, int data_len) {
+    memset(cpu->reg, 0, sizeof(cpu->reg));
+    memset(cpu->sreg, 0, sizeof(cpu->sreg));
+    cpu->reg[RMEMU_AX] = 0x1130;
+    cpu->reg[RMEMU_BX] = bh << 8;
+    cpu->sreg[RMEMU_SS] = 0x9000;
+    cpu->reg[RMEMU_SP] = 0xFFFE;
+    cpu->flags = 0x0202;
+    if (rmemu_call_int(cpu, RMEMU_ROM_SEG, handler, MAX_STEPS) != RMEMU_OK) {
+        return -1;
+    }
+    long addr = ((long)cpu->sreg[RMEMU_ES] << 4) + cpu->reg[RMEMU_BP] - (RMEMU_ROM_SEG << 4);
+    return addr >= 0 && addr < data_len ? (int)addr : -1;
+}
+
+int alt_table_size(const uint8_t *data, int data_len, int offset, int record) {
+    if (offset < 0) {
+        return -1;
+    }
+    for (int i = 0; i <= MAX_ALT_RECORDS; i++) {
+        int pos = offset + i * record;
+        if (pos >= data_len || (data[pos] != 0 && pos + record > data_len)) {
+            return -1;
+        }
+        if (data[pos] == 0) {
+            return pos - offset + 1;
+        }
+    }
+    return -1;
+}
+
+// Таблица 8x8 в BIOS одна: BH=4 возвращает её вторую половину. Это
+// заодно проверяет, что выполнилась именно функция 1130h.
+static int check_pointers(const uint8_t *data, int data_len, font_pointers_t *p, int upper_8x8) {
+    if (p->offset_9x14 >= 0 &&
+        alt_table_size(data, data_len, p->offset_9x14, FONTPTR_ALT_9X14_RECORD) < 0) {
+        p->offset_9x14 = -1;
+    }
+    if (p->offset_9x16 >= 0 &&
+        alt_table_size(data, data_len, p->offset_9x16, FONTPTR_ALT_9X16_RECORD) < 0) {
+        p->offset_9x16 = -1;
+    }
+    return p->offset_8x8 >= 0 && p->offset_8x8 + FONT_8X8_SIZE <= data_len &&
+           upper_8x8 == p->offset_8x8 + FONT_8X8_SIZE / 2 &&
+           p->offset_8x14 >= 0 && p->offset_8x14 + FONT_8X14_SIZE <= data_len &&
+           p->offset_8x16 >= 0 && p->offset_8x16 + FONT_8X16_SIZE <= data_len;
+}
+
+// Запрашивает у обработчика все таблицы; 1 - адреса верны
+static int query_handler(rmemu_t *cpu, const uint8_t *data, int data_len, int handler,
+                         font_pointers_t *ptrs) {
+    // Вложенные вызовы INT 10h попадают в тот же обработчик
+    uint8_t *vec = cpu->mem + INT10_VECTOR;
+    vec[0] = handler & 0xFF;
+    vec[1] = handler >> 8;
+    vec[2] = RMEMU_ROM_SEG & 0xFF;
+    vec[3] = RMEMU_ROM_SEG >> 8;
+
+    font_pointers_t p;
+    p.handler = handler;
+    p.offset_8x14 = get_font_pointer(cpu, handler, 2, data_len);
+    p.offset_8x8 = get_font_pointer(cpu, handler, 3, data_len);
+    int upper = get_font_pointer(cpu, handler, 4, data_len);
+    p.offset_9x14 = get_font_pointer(cpu, handler, 5, data_len);
+    p.offset_8x16 = get_font_pointer(cpu, handler, 6, data_len);
+    p.offset_9x16 = get_font_pointer(cpu, handler, 7, data_len);
+    if (!check_pointers(data, data_len, &p, upper)) {
+        return 0;
+    }
+    *ptrs = p;
+    return 1;
+}
+
+int find_font_pointers(const uint8_t *data, int data_len, font_pointers_t *ptrs) {
+    walk_t w = { .data = data, .len = data_len };
+    rmemu_t cpu;
+
+    memset(ptrs, 0xFF, sizeof(*ptrs));
+    if (data_len <= ENTRY_POINT || data_len > RMEMU_MAX_ROM) {
+        return -1;
+    }
+    w.seen = calloc(data_len, 1);
+    w.queue = malloc(data_len * sizeof(*w.queue));
+    if (!w.seen || !w.queue || rmemu_init(&cpu, data, data_len) != RMEMU_OK) {
+        free(w.seen);
+        free(w.queue);
+        return -1;
+    }
+
+    // Вектор обычно ставится в начале инициализации, поэтому каждый
+    // кандидат проверяется сразу, а обход кода на этом заканчивается
+    int found = 0, tested = 0;
+    add_target(&w, ENTRY_POINT);
+    while (w.head < w.nqueue && !found) {
+        walk_block(&w, w.queue[w.head++]);
+        while (tested < w.nhandlers && !found) {
+            found = query_handler(&cpu, data, data_len, w.handlers[tested++], ptrs);
+        }
+    }
+    rmemu_free(&cpu);
+    free(w.seen);
+    free(w.queue);
+    return found ? 0 : -1;
+}
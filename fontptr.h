@@ -0,0 +1,35 @@
+#ifndef ___FONTPTR_H___
+#define ___FONTPTR_H___
+
+#include <stdint.h>
+
+// Поиск таблиц шрифтов по коду самого BIOS: функция INT 10h AX=1130h
+// возвращает в ES:BP адреса шрифтов ROM. Обработчик INT 10h находится
+// разбором кода от точки входа (смещение 3) - по записи его адреса в
+// вектор 10h (0000:0040), - затем функция 1130h выполняется в эмуляторе
+// (rmemu.h) для BH = 2..7 на образе в памяти.
+
+// Таблицы исправлений 9-точечных шрифтов: записи из кода символа и
+// глифа 8x14 или 8x16, в конце - нулевой байт
+#define FONTPTR_ALT_9X14_RECORD 15
+#define FONTPTR_ALT_9X16_RECORD 17
+
+typedef struct {
+    int handler;            // смещение обработчика INT 10h, -1 - не найден
+    int offset_8x8;         // -1 - BIOS не вернул адрес внутри образа
+    int offset_8x14;
+    int offset_8x16;
+    int offset_9x14;        // таблицы исправлений 9x14 и 9x16
+    int offset_9x16;
+} font_pointers_t;
+
+// Заполняет ptrs по линейному образу. Возвращает 0, если обработчик
+// найден и вернул адреса всех трёх таблиц 8x8, 8x14 и 8x16, иначе -1
+// (найденное всё равно записывается в ptrs).
+int find_font_pointers(const uint8_t *data, int data_len, font_pointers_t *ptrs);
+
+// Длина таблицы исправлений 9-точечного шрифта с записями record байт,
+// включая завершающий ноль, или -1, если таблица не помещается в образ
+int alt_table_size(const uint8_t *data, int data_len, int offset, int record);
+
+#endif // ___FONTPTR_H___
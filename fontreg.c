@@ -0,0 +1,88 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fontreg.h"
+
+#define GLYPHS 256
+
+static const int glyph_height[FONTREG_TABLES] = { 8, 14, 16 };
+
+// Распакованные таблицы: по FONTREG_TABLES указателей на шрифт
+static pthread_mutex_t reg_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t **unpacked = NULL;
+
+int fontreg_count(void) {
+    return fontreg_nentries;
+}
+
+const char *fontreg_name(int idx) {
+    if (idx < 0 || idx >= fontreg_nentries) {
+        return NULL;
+    }
+    return fontreg_entries[idx].name;
+}
+
+int fontreg_find(const char *name) {
+    if (!name || !*name) {
+        return fontreg_nentries > 0 ? fontreg_default : -1;
+    }
+    for (int i = 0; i < fontreg_nentries; i++) {
+        if (strcmp(fontreg_entries[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Распаковка одного глифа; ссылка ведёт на глиф, записанный целиком
+// Возвращает указатель на следующий глиф
+static const uint8_t *unpack_glyph(const uint8_t *data, const uint8_t *p, uint8_t *glyph, int height) {
+    memset(glyph, 0, height);
+    if (*p == FONTREG_REF) {
+        unpack_glyph(data, data + (p[1] | p[2] << 8 | p[3] << 16), glyph, height);
+        return p + 4;
+    }
+    if (*p == FONTREG_BLANK) {
+        return p + 1;
+    }
+    int top = *p >> 4;
+    int rows = (*p & 0x0F) + 1;
+    memcpy(glyph + top, p + 1, rows);
+    return p + 1 + rows;
+}
+
+static uint8_t *unpack_table(int table, int32_t offset) {
+    int height = glyph_height[table];
+    uint8_t *font = malloc(GLYPHS * height);
+    if (!font) {
+        return NULL;
+    }
+    const uint8_t *data = fontreg_data[table];
+    const uint8_t *p = data + offset;
+    for (int c = 0; c < GLYPHS; c++) {
+        p = unpack_glyph(data, p, font + c * height, height);
+    }
+    return font;
+}
+
+const uint8_t *fontreg_table(int idx, int table) {
+    if (idx < 0 || idx >= fontreg_nentries || table < 0 || table >= FONTREG_TABLES ||
+        fontreg_entries[idx].table[table] == FONTREG_NONE) {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&reg_lock);
+    if (!unpacked) {
+        unpacked = calloc(fontreg_nentries * FONTREG_TABLES, sizeof(*unpacked));
+    }
+    uint8_t *font = NULL;
+    if (unpacked) {
+        uint8_t **slot = &unpacked[idx * FONTREG_TABLES + table];
+        if (!*slot) {
+            *slot = unpack_table(table, fontreg_entries[idx].table[table]);
+        }
+        font = *slot;
+    }
+    pthread_mutex_unlock(&reg_lock);
+    return font;
+}
@@ -0,0 +1,52 @@
+#ifndef ___FONTREG_H___
+#define ___FONTREG_H___
+
+#include <stdint.h>
+
+// Реестр встроенных шрифтов. Данные генерирует utils/mkfontreg из
+// fnt/<имя>-8x8.fnt, fnt/<имя>-8x14.fnt и fnt/<имя>-8x16.fnt в
+// fontreg_data.c и хранит их сжатыми; таблица распаковывается при
+// первом обращении к ней. Функции можно вызывать из нескольких потоков.
+
+// Таблицы шрифта в порядке VGAROM_FONT_*: 8x8, 8x14, 8x16
+#define FONTREG_TABLES 3
+
+// Число встроенных шрифтов
+int fontreg_count(void);
+
+// Имя шрифта с номером idx
+const char *fontreg_name(int idx);
+
+// Номер шрифта по имени; NULL или "" - шрифт по умолчанию.
+// -1 - такого шрифта нет.
+int fontreg_find(const char *name);
+
+// Распакованная таблица шрифта (только для чтения, живёт до конца
+// программы) или NULL, если у шрифта нет такой таблицы или не хватило памяти
+const uint8_t *fontreg_table(int idx, int table);
+
+// Формат сгенерированных данных. Таблицы одной высоты записаны подряд
+// в общий массив, глиф за глифом. Глиф начинается с байта заголовка:
+//   (top << 4) | (rows - 1) - далее rows строк глифа, начиная со строки
+//                             top; остальные строки нулевые
+//   FONTREG_BLANK           - пустой глиф
+//   FONTREG_REF             - далее 3 байта (младший первым) - смещение
+//                             такого же глифа в том же массиве
+// top + rows не больше высоты глифа, поэтому FONTREG_BLANK и FONTREG_REF
+// не совпадают ни с одним заголовком строк.
+
+#define FONTREG_BLANK 0xFF
+#define FONTREG_REF   0xFE
+#define FONTREG_NONE  -1        // у шрифта нет таблицы
+
+typedef struct {
+    const char *name;
+    int32_t table[FONTREG_TABLES];  // смещение таблицы или FONTREG_NONE
+} fontreg_entry_t;
+
+extern const fontreg_entry_t fontreg_entries[];
+extern const int fontreg_nentries;
+extern const int fontreg_default;
+extern const uint8_t *const fontreg_data[FONTREG_TABLES];
+
+#endif // ___FONTREG_H___
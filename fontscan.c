@@ -0,0 +1,778 @@
+#include <stdlib.h>
+#include <string.h>
+#include "fontscan.h"
+#include "interleave.h"
+
+#ifdef CPU_X86
+#include <immintrin.h>
+#endif
+
+// Векторный поиск сигнатуры идёт по якорю - её последним FONT_ANCHOR_LEN
+// байтам. У сигнатур шрифтов это первые строки "смайлика" 7E 81 A5 81,
+// а серию нулей перед ними проверяем уже после совпадения.
+
+int find_signature_scalar(const uint8_t *data, int data_len,
+                          const uint8_t *signature, int sig_len, int search_start_pos) {
+    for (int i = search_start_pos; i <= data_len - sig_len; i++) {
+        int found = 1;
+        for (int j = 0; j < sig_len; j++) {
+            if (data[i + j] != signature[j]) {
+                found = 0;
+                break;
+            }
+        }
+        if (found) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#ifdef CPU_X86
+
+// Проверка кандидатов по маске совпадений первого и последнего байта якоря.
+// Биты маски перебираются по возрастанию, поэтому находится первое вхождение.
+static inline int check_candidates(const uint8_t *data, unsigned mask, int base,
+                                   const uint8_t *signature, int sig_len) {
+    while (mask) {
+        int i = base + __builtin_ctz(mask);
+        if (memcmp(data + i, signature, sig_len) == 0) {
+            return i;
+        }
+        mask &= mask - 1;
+    }
+    return -1;
+}
+
+__attribute__((target("sse2")))
+int find_signature_sse2(const uint8_t *data, int data_len,
+                        const uint8_t *signature, int sig_len, int search_start_pos) {
+    if (search_start_pos < 0) {
+        search_start_pos = 0;
+    }
+    if (sig_len < FONT_ANCHOR_LEN) {
+        return find_signature_scalar(data, data_len, signature, sig_len, search_start_pos);
+    }
+
+    // Позиция i - начало сигнатуры, якорь лежит по адресу i + a
+    const int a = sig_len - FONT_ANCHOR_LEN;
+    const __m128i first = _mm_set1_epi8((char)signature[a]);
+    const __m128i last = _mm_set1_epi8((char)signature[sig_len - 1]);
+    int i = search_start_pos;
+
+    for (; i + sig_len - 1 + 16 <= data_len; i += 16) {
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(data + i + a));
+        __m128i v3 = _mm_loadu_si128((const __m128i *)(data + i + sig_len - 1));
+        unsigned mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(v0, first),
+                                                        _mm_cmpeq_epi8(v3, last)));
+        int pos = check_candidates(data, mask, i, signature, sig_len);
+        if (pos >= 0) {
+            return pos;
+        }
+    }
+    return find_signature_scalar(data, data_len, signature, sig_len, i);
+}
+
+__attribute__((target("avx2")))
+int find_signature_avx2(const uint8_t *data, int data_len,
+                        const uint8_t *signature, int sig_len, int search_start_pos) {
+    if (search_start_pos < 0) {
+        search_start_pos = 0;
+    }
+    if (sig_len < FONT_ANCHOR_LEN) {
+        return find_signature_scalar(data, data_len, signature, sig_len, search_start_pos);
+    }
+
+    const int a = sig_len - FONT_ANCHOR_LEN;
+    const __m256i first = _mm256_set1_epi8((char)signature[a]);
+    const __m256i last = _mm256_set1_epi8((char)signature[sig_len - 1]);
+    int i = search_start_pos;
+
+    for (; i + sig_len - 1 + 32 <= data_len; i += 32) {
+        __m256i v0 = _mm256_loadu_si256((const __m256i *)(data + i + a));
+        __m256i v3 = _mm256_loadu_si256((const __m256i *)(data + i + sig_len - 1));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(v0, first),
+                                                                        _mm256_cmpeq_epi8(v3, last)));
+        int pos = check_candidates(data, mask, i, signature, sig_len);
+        if (pos >= 0) {
+            return pos;
+        }
+    }
+    return find_signature_sse2(data, data_len, signature, sig_len, i);
+}
+
+#endif // CPU_X86
+
+int find_signature(const uint8_t *data, int data_len,
+                   const uint8_t *signature, int sig_len, int search_start_pos) {
+#ifdef CPU_X86
+    if (cpu_have_avx2()) {
+        return find_signature_avx2(data, data_len, signature, sig_len, search_start_pos);
+    }
+    if (cpu_have_sse2()) {
+        return find_signature_sse2(data, data_len, signature, sig_len, search_start_pos);
+    }
+#endif
+    return find_signature_scalar(data, data_len, signature, sig_len, search_start_pos);
+}
+
+// Сигнатуры таблиц, используются при переполнении списка якорей
+static const uint8_t FONT_8X8_SIGNATURE[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x81, 0xA5, 0x81
+};
+static const uint8_t FONT_8X14_SIGNATURE[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7E, 0x81, 0xA5, 0x81
+};
+static const uint8_t FONT_8X16_SIGNATURE[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x81, 0xA5, 0x81
+};
+static const uint8_t *const FONT_ANCHOR = FONT_8X8_SIGNATURE + 8;
+
+// Параметры трёх таблиц: высота глифа, размер и длина серии нулей
+// перед якорем (глиф 0 плюс две пустые строки глифа 1 у 8x14/8x16)
+enum { FONT_8X8, FONT_8X14, FONT_8X16, FONT_COUNT };
+static const int font_height[FONT_COUNT] = { 8, 14, 16 };
+static const int font_size[FONT_COUNT] = { FONT_8X8_SIZE, FONT_8X14_SIZE, FONT_8X16_SIZE };
+static const int font_zeros[FONT_COUNT] = { 8, 16, 18 };
+
+// Длина серии нулей перед якорем, не больше, чем нужно для 8x16
+static int zero_run(const uint8_t *data, int pos) {
+    int z = 0;
+    while (z < font_zeros[FONT_8X16] && pos - z - 1 >= 0 && data[pos - z - 1] == 0) {
+        z++;
+    }
+    return z;
+}
+
+// Сбор якорей, начинающихся в позициях [start, end - FONT_ANCHOR_LEN]:
+// найденные дописываются в hits с индекса n. Возвращает новое число
+// якорей или max_hits + 1 при переполнении. Якорь не перекрывается
+// сам с собой, поэтому все совпадения различны.
+static int collect_anchors_scalar(const uint8_t *data, int start, int end,
+                                  font_anchor_t *hits, int n, int max_hits) {
+    for (int i = start; i <= end - FONT_ANCHOR_LEN; i++) {
+        if (memcmp(data + i, FONT_ANCHOR, FONT_ANCHOR_LEN) != 0) {
+            continue;
+        }
+        if (n == max_hits) {
+            return max_hits + 1;
+        }
+        hits[n].pos = i;
+        hits[n].zeros = zero_run(data, i);
+        n++;
+    }
+    return n;
+}
+
+#ifdef CPU_X86
+
+// Биты маски - позиции, где совпали первый и последний байт якоря;
+// средние байты проверяются здесь. Якоря добавляются по возрастанию.
+static inline int add_anchors(const uint8_t *data, uint64_t mask, int base,
+                              font_anchor_t *hits, int n, int max_hits) {
+    for (; mask; mask &= mask - 1) {
+        int i = base + __builtin_ctzll(mask);
+        if (data[i + 1] != FONT_ANCHOR[1] || data[i + 2] != FONT_ANCHOR[2]) {
+            continue;
+        }
+        if (n == max_hits) {
+            return max_hits + 1;
+        }
+        hits[n].pos = i;
+        hits[n].zeros = zero_run(data, i);
+        n++;
+    }
+    return n;
+}
+
+// Один проход по данным: маска кандидатов из сравнений с 7E и 81,
+// затем обход её битов
+__attribute__((target("sse2")))
+static int collect_anchors_sse2(const uint8_t *data, int start, int end,
+                                font_anchor_t *hits, int n, int max_hits) {
+    const __m128i first = _mm_set1_epi8((char)FONT_ANCHOR[0]);
+    const __m128i last = _mm_set1_epi8((char)FONT_ANCHOR[FONT_ANCHOR_LEN - 1]);
+    int i = start;
+
+    for (; i + FONT_ANCHOR_LEN - 1 + 16 <= end && n <= max_hits; i += 16) {
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i v3 = _mm_loadu_si128((const __m128i *)(data + i + FONT_ANCHOR_LEN - 1));
+        unsigned mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(v0, first),
+                                                        _mm_cmpeq_epi8(v3, last)));
+        if (mask) {
+            n = add_anchors(data, mask, i, hits, n, max_hits);
+        }
+    }
+    if (n > max_hits) {
+        return n;
+    }
+    return collect_anchors_scalar(data, i, end, hits, n, max_hits);
+}
+
+__attribute__((target("avx2")))
+static int collect_anchors_avx2(const uint8_t *data, int start, int end,
+                                font_anchor_t *hits, int n, int max_hits) {
+    const __m256i first = _mm256_set1_epi8((char)FONT_ANCHOR[0]);
+    const __m256i last = _mm256_set1_epi8((char)FONT_ANCHOR[FONT_ANCHOR_LEN - 1]);
+    int i = start;
+
+    // По 64 байта за шаг: кандидаты редки, и проверка маски общая
+    for (; i + FONT_ANCHOR_LEN - 1 + 64 <= end && n <= max_hits; i += 64) {
+        const uint8_t *p = data + i;
+        __m256i lo = _mm256_and_si256(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)p), first),
+            _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(p + FONT_ANCHOR_LEN - 1)), last));
+        __m256i hi = _mm256_and_si256(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(p + 32)), first),
+            _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(p + 32 + FONT_ANCHOR_LEN - 1)), last));
+        if (_mm256_testz_si256(_mm256_or_si256(lo, hi), _mm256_or_si256(lo, hi))) {
+            continue;
+        }
+        uint64_t mask = (uint32_t)_mm256_movemask_epi8(lo) |
+                        (uint64_t)(uint32_t)_mm256_movemask_epi8(hi) << 32;
+        n = add_anchors(data, mask, i, hits, n, max_hits);
+    }
+    if (n > max_hits) {
+        return n;
+    }
+    return collect_anchors_sse2(data, i, end, hits, n, max_hits);
+}
+
+#endif // CPU_X86
+
+static int collect_anchors(const uint8_t *data, int start, int end,
+                           font_anchor_t *hits, int n, int max_hits) {
+#ifdef CPU_X86
+    if (cpu_have_avx2()) {
+        return collect_anchors_avx2(data, start, end, hits, n, max_hits);
+    }
+    if (cpu_have_sse2()) {
+        return collect_anchors_sse2(data, start, end, hits, n, max_hits);
+    }
+#endif
+    return collect_anchors_scalar(data, start, end, hits, n, max_hits);
+}
+
+int scan_font_anchors(const uint8_t *data, int data_len,
+                      font_anchor_t *hits, int max_hits) {
+    return collect_anchors(data, 0, data_len, hits, 0, max_hits);
+}
+
+// Высота таблицы по шагу глифов: у стандартного глифа 2 верхние
+// непустые строки 7E FF, они стоят ровно через высоту глифа после якоря.
+// Возвращает индекс таблицы или -1, если глиф 2 нестандартный.
+static int anchor_pitch(const uint8_t *data, int data_len, int pos) {
+    int found = -1;
+    for (int f = 0; f < FONT_COUNT; f++) {
+        int p = pos + font_height[f];
+        if (p + 1 < data_len && data[p] == 0x7E && data[p + 1] == 0xFF) {
+            if (found >= 0) {
+                return -1;
+            }
+            found = f;
+        }
+    }
+    return found;
+}
+
+void classify_font_anchors(const uint8_t *data, int data_len,
+                           const font_anchor_t *hits, int nhits,
+                           font_layout_t *layout) {
+    int offset[FONT_COUNT] = { -1, -1, -1 };
+    int pitch[FONT_MAX_ANCHORS];
+
+    if (nhits > FONT_MAX_ANCHORS) {
+        nhits = FONT_MAX_ANCHORS;
+    }
+
+    // Сначала таблицы, опознанные по шагу глифов, - в любом порядке
+    for (int i = 0; i < nhits; i++) {
+        int f = pitch[i] = anchor_pitch(data, data_len, hits[i].pos);
+        if (f >= 0 && offset[f] < 0 && hits[i].zeros >= font_zeros[f]) {
+            offset[f] = hits[i].pos - font_zeros[f];
+        }
+    }
+
+    // Остальные - по прежним правилам: 8x8, за ним 8x14, за ним 8x16,
+    // каждая следующая ищется после конца предыдущей
+    int search_start = 0;
+    for (int f = 0; f < FONT_COUNT; f++) {
+        for (int i = 0; offset[f] < 0 && i < nhits; i++) {
+            int start = hits[i].pos - font_zeros[f];
+            if (start < search_start || hits[i].zeros < font_zeros[f] ||
+                (pitch[i] >= 0 && pitch[i] != f)) {
+                continue;
+            }
+            // Якорь внутри уже найденной таблицы не подходит
+            int inside = 0;
+            for (int g = 0; g < FONT_COUNT; g++) {
+                if (offset[g] >= 0 && hits[i].pos >= offset[g] &&
+                    hits[i].pos < offset[g] + font_size[g]) {
+                    inside = 1;
+                }
+            }
+            if (!inside) {
+                offset[f] = start;
+            }
+        }
+        if (offset[f] >= 0) {
+            search_start = offset[f] + font_size[f];
+        }
+    }
+
+    layout->offset_8x8 = offset[FONT_8X8];
+    layout->offset_8x14 = offset[FONT_8X14];
+    layout->offset_8x16 = offset[FONT_8X16];
+}
+
+// Поиск по собранным якорям, при переполнении списка - цепочкой сигнатур
+static void locate_from_anchors(const uint8_t *data, int data_len,
+                                const font_anchor_t *hits, int nhits,
+                                font_layout_t *layout) {
+    if (nhits <= FONT_MAX_ANCHORS) {
+        classify_font_anchors(data, data_len, hits, nhits, layout);
+        return;
+    }
+
+    int search_start = 0;
+    layout->offset_8x8 = find_signature(data, data_len, FONT_8X8_SIGNATURE,
+                                        sizeof(FONT_8X8_SIGNATURE), search_start);
+    if (layout->offset_8x8 >= 0) {
+        search_start = layout->offset_8x8 + FONT_8X8_SIZE;
+    }
+    layout->offset_8x14 = find_signature(data, data_len, FONT_8X14_SIGNATURE,
+                                         sizeof(FONT_8X14_SIGNATURE), search_start);
+    if (layout->offset_8x14 >= 0) {
+        search_start = layout->offset_8x14 + FONT_8X14_SIZE;
+    }
+    layout->offset_8x16 = find_signature(data, data_len, FONT_8X16_SIGNATURE,
+                                         sizeof(FONT_8X16_SIGNATURE), search_start);
+}
+
+void locate_fonts(const uint8_t *data, int data_len, font_layout_t *layout) {
+    font_anchor_t hits[FONT_MAX_ANCHORS];
+    int nhits = scan_font_anchors(data, data_len, hits, FONT_MAX_ANCHORS);
+
+    locate_from_anchors(data, data_len, hits, nhits, layout);
+}
+
+void locate_fonts_analyzed(const uint8_t *data, int data_len,
+                           const rom_analysis_t *analysis, font_layout_t *layout) {
+    locate_from_anchors(data, data_len, analysis->anchors, analysis->nanchors, layout);
+}
+
+static int font_table_score(const uint8_t *data, int offset, int f);
+
+int verify_font_layout(const uint8_t *data, int data_len, const font_layout_t *layout) {
+    static const uint8_t *const signature[FONT_COUNT] = {
+        FONT_8X8_SIGNATURE, FONT_8X14_SIGNATURE, FONT_8X16_SIGNATURE
+    };
+    const int offset[FONT_COUNT] = { layout->offset_8x8, layout->offset_8x14, layout->offset_8x16 };
+
+    for (int f = 0; f < FONT_COUNT; f++) {
+        if (offset[f] < 0) {
+            continue;
+        }
+        if (offset[f] > data_len - font_size[f]) {
+            return 0;
+        }
+        if (memcmp(data + offset[f], signature[f], font_zeros[f] + FONT_ANCHOR_LEN) != 0 &&
+            font_table_score(data, offset[f], f) < FONT_ACCEPT_SCORE) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+#ifdef CPU_X86
+// psadbw складывает по 8 байт в 64-битные суммы
+__attribute__((target("sse2")))
+static uint8_t byte_sum_sse2(const uint8_t *data, int len) {
+    __m128i acc = _mm_setzero_si128();
+    int i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(data + i));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(v, _mm_setzero_si128()));
+    }
+    uint8_t sum = (uint8_t)(_mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_srli_si128(acc, 8)));
+    for (; i < len; i++) {
+        sum += data[i];
+    }
+    return sum;
+}
+#endif
+
+uint8_t byte_sum(const uint8_t *data, int len) {
+#ifdef CPU_X86
+    if (cpu_have_sse2()) {
+        return byte_sum_sse2(data, len);
+    }
+#endif
+    uint8_t sum = 0;
+    for (int i = 0; i < len; i++) {
+        sum += data[i];
+    }
+    return sum;
+}
+
+// Размер блока первого прохода: помещается в L1 вместе со входом
+#define ANALYZE_BLOCK 4096
+
+void analyze_rom(const uint8_t *in, uint8_t *out, int size, int odd_offset,
+                 rom_analysis_t *analysis) {
+    int next = 0;   // первая позиция, с которой ещё не искали якорь
+
+    analysis->sum = 0;
+    analysis->nanchors = 0;
+
+    for (int blk = 0; blk < size; blk += ANALYZE_BLOCK) {
+        int len = size - blk < ANALYZE_BLOCK ? size - blk : ANALYZE_BLOCK;
+
+        if (odd_offset > 0) {
+            // blk чётный, поэтому смещение нечётной половины не меняется
+            deinterleave(in + blk / 2, out + blk, len, odd_offset);
+        } else if (in != out) {
+            memcpy(out + blk, in + blk, len);
+        }
+
+        // Последний байт - контрольная сумма, в сумму не входит
+        analysis->sum += byte_sum(out + blk, blk + len == size ? len - 1 : len);
+
+        // Якоря, целиком лежащие в уже готовой части образа, включая
+        // стык с предыдущим блоком
+        int end = blk + len;
+        if (analysis->nanchors <= FONT_MAX_ANCHORS) {
+            analysis->nanchors = collect_anchors(out, next, end, analysis->anchors,
+                                                 analysis->nanchors, FONT_MAX_ANCHORS);
+        }
+        if (next < end - FONT_ANCHOR_LEN + 1) {
+            next = end - FONT_ANCHOR_LEN + 1;
+        }
+    }
+    analysis->checksum_byte = size > 0 ? out[size - 1] : 0;
+}
+
+const char *find_signature_impl(void) {
+#ifdef CPU_X86
+    if (cpu_have_avx2()) {
+        return "avx2";
+    }
+    if (cpu_have_sse2()) {
+        return "sse2";
+    }
+#endif
+    return "scalar";
+}
+
+// Расстояние до глифа: две половины по 8 байт
+#define GLYPH_DISTANCE(w, g) \
+    (__builtin_popcountll((w)[0] ^ (g)[0]) + __builtin_popcountll((w)[1] ^ (g)[1]))
+
+int glyph_distance_min_scalar(const uint8_t *window, const uint8_t *glyphs, int n) {
+    uint64_t w[2], g[2];
+    int best = 255;
+
+    memcpy(w, window, sizeof(w));
+    for (int i = 0; i < n; i++) {
+        memcpy(g, glyphs + i * 16, sizeof(g));
+        int d = GLYPH_DISTANCE(w, g);
+        if (d < best) {
+            best = d;
+        }
+    }
+    return best;
+}
+
+#ifdef CPU_X86
+// Та же скалярная версия, но popcount компилируется в одну инструкцию,
+// а не в вызов библиотечной функции
+__attribute__((target("popcnt")))
+int glyph_distance_min_popcnt(const uint8_t *window, const uint8_t *glyphs, int n) {
+    uint64_t w[2], g[2];
+    int best = 255;
+
+    memcpy(w, window, sizeof(w));
+    for (int i = 0; i < n; i++) {
+        memcpy(g, glyphs + i * 16, sizeof(g));
+        int d = GLYPH_DISTANCE(w, g);
+        if (d < best) {
+            best = d;
+        }
+    }
+    return best;
+}
+
+// Расстояния до двух глифов в половинах регистра: XOR с окном,
+// число бит в каждом байте по таблице для полубайтов (pshufb), psadbw
+// складывает байты в суммы по 8 байт, а сумма двух 64-битных слов
+// половины - расстояние до её глифа
+__attribute__((target("avx2")))
+static inline __m256i pair_distance(__m256i x, __m256i nibble_bits, __m256i low) {
+    __m256i bits = _mm256_add_epi8(
+        _mm256_shuffle_epi8(nibble_bits, _mm256_and_si256(x, low)),
+        _mm256_shuffle_epi8(nibble_bits, _mm256_and_si256(_mm256_srli_epi16(x, 4), low)));
+    __m256i sums = _mm256_sad_epu8(bits, _mm256_setzero_si256());
+    return _mm256_add_epi64(sums, _mm256_shuffle_epi32(sums, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+__attribute__((target("avx2,popcnt")))
+int glyph_distance_min_avx2(const uint8_t *window, const uint8_t *glyphs, int n) {
+    const __m256i nibble_bits = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    const __m256i w = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)window));
+    __m256i best = _mm256_set1_epi32(255);
+    int i = 0;
+
+    // Четыре глифа за итерацию - две независимые цепочки
+    for (; i + 4 <= n; i += 4) {
+        __m256i x0 = _mm256_xor_si256(w, _mm256_loadu_si256((const __m256i *)(glyphs + i * 16)));
+        __m256i x1 = _mm256_xor_si256(w, _mm256_loadu_si256((const __m256i *)(glyphs + i * 16 + 32)));
+        best = _mm256_min_epu32(best, _mm256_min_epu32(pair_distance(x0, nibble_bits, low),
+                                                       pair_distance(x1, nibble_bits, low)));
+    }
+    for (; i + 2 <= n; i += 2) {
+        __m256i x = _mm256_xor_si256(w, _mm256_loadu_si256((const __m256i *)(glyphs + i * 16)));
+        best = _mm256_min_epu32(best, pair_distance(x, nibble_bits, low));
+    }
+
+    // Расстояния - в младших 32-битных словах половин
+    int d0 = _mm256_extract_epi32(best, 0);
+    int d1 = _mm256_extract_epi32(best, 4);
+    int result = d0 < d1 ? d0 : d1;
+    if (i < n) {
+        int d = glyph_distance_min_popcnt(window, glyphs + i * 16, n - i);
+        if (d < result) {
+            result = d;
+        }
+    }
+    return result;
+}
+#endif // CPU_X86
+
+int glyph_distance_min(const uint8_t *window, const uint8_t *glyphs, int n) {
+#ifdef CPU_X86
+    if (cpu_have_avx2() && cpu_have_popcnt()) {
+        return glyph_distance_min_avx2(window, glyphs, n);
+    }
+    if (cpu_have_popcnt()) {
+        return glyph_distance_min_popcnt(window, glyphs, n);
+    }
+#endif
+    return glyph_distance_min_scalar(window, glyphs, n);
+}
+
+const char *glyph_distance_impl(void) {
+#ifdef CPU_X86
+    if (cpu_have_avx2() && cpu_have_popcnt()) {
+        return "avx2";
+    }
+    if (cpu_have_popcnt()) {
+        return "popcnt";
+    }
+#endif
+    return "scalar";
+}
+
+// Статистика строк глифов: нулевые строки и число бит, которые меняются
+// от строки к следующей (у букв соседние строки похожи, у кода и
+// данных - нет)
+void glyph_row_stats_scalar(const uint8_t *rows, int len, glyph_row_stats_t *stats) {
+    stats->zero_rows = 0;
+    stats->changed_bits = 0;
+    for (int i = 0; i < len; i++) {
+        stats->zero_rows += rows[i] == 0;
+        if (i + 1 < len) {
+            stats->changed_bits += __builtin_popcount(rows[i] ^ rows[i + 1]);
+        }
+    }
+}
+
+#ifdef CPU_X86
+// По 32 строки: XOR со сдвинутой на байт загрузкой, число бит по
+// таблице полубайтов и psadbw; нулевые строки - по маске сравнения
+__attribute__((target("avx2,popcnt")))
+void glyph_row_stats_avx2(const uint8_t *rows, int len, glyph_row_stats_t *stats) {
+    const __m256i nibble_bits = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    __m256i changed = _mm256_setzero_si256();
+    int zero_rows = 0;
+    int i = 0;
+
+    for (; i + 33 <= len; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(rows + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(rows + i + 1));
+        __m256i x = _mm256_xor_si256(a, b);
+        __m256i bits = _mm256_add_epi8(
+            _mm256_shuffle_epi8(nibble_bits, _mm256_and_si256(x, low)),
+            _mm256_shuffle_epi8(nibble_bits, _mm256_and_si256(_mm256_srli_epi16(x, 4), low)));
+        changed = _mm256_add_epi64(changed, _mm256_sad_epu8(bits, _mm256_setzero_si256()));
+        zero_rows += _mm_popcnt_u32(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, _mm256_setzero_si256())));
+    }
+    __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(changed), _mm256_extracti128_si256(changed, 1));
+    int changed_bits = _mm_cvtsi128_si32(sum) + _mm_cvtsi128_si32(_mm_srli_si128(sum, 8));
+
+    glyph_row_stats_scalar(rows + i, len - i, stats);
+    stats->zero_rows += zero_rows;
+    stats->changed_bits += changed_bits;
+}
+#endif // CPU_X86
+
+void glyph_row_stats(const uint8_t *rows, int len, glyph_row_stats_t *stats) {
+#ifdef CPU_X86
+    if (cpu_have_avx2() && cpu_have_popcnt()) {
+        glyph_row_stats_avx2(rows, len, stats);
+        return;
+    }
+#endif
+    glyph_row_stats_scalar(rows, len, stats);
+}
+
+// Эвристический поиск таблиц без сигнатуры. Таблица кодовых страниц
+// 437 и 866 узнаётся по глифам, которые в них совпадают: 0x00, 0x20 и
+// 0xFF пустые, 0xDB - сплошной блок, 0xB3 - вертикальная линия, 0xC4 -
+// горизонтальная, а у печатных символов 0x21-0x7E нет пустых глифов и
+// соседние строки похожи. Кандидаты отбираются по пустому глифу 0x20 и
+// сплошному 0xDB, остальные признаки дают баллы.
+#define SCORE_ASCII_FIRST 0x21
+#define SCORE_ASCII_COUNT (0x7F - SCORE_ASCII_FIRST)
+
+static int zero_bytes(const uint8_t *p, int n) {
+    int z = 0;
+    for (int i = 0; i < n; i++) {
+        z += p[i] == 0;
+    }
+    return z;
+}
+
+// n байт, от 4 до 16, равны fill (0 или 0xFF); две перекрывающиеся загрузки
+static int is_filled(const uint8_t *p, int n, uint8_t fill) {
+    if (n < 8) {
+        uint32_t a, b;
+        memcpy(&a, p, 4);
+        memcpy(&b, p + n - 4, 4);
+        return a == b && a == fill * 0x01010101U;
+    }
+    uint64_t a, b;
+    memcpy(&a, p, 8);
+    memcpy(&b, p + n - 8, 8);
+    return a == b && a == fill * 0x0101010101010101ULL;
+}
+
+static int is_blank(const uint8_t *p, int n) {
+    return is_filled(p, n, 0);
+}
+
+static int solid_bytes(const uint8_t *p, int n) {
+    int s = 0;
+    for (int i = 0; i < n; i++) {
+        s += p[i] == 0xFF;
+    }
+    return s;
+}
+
+// Оценка таблицы высоты font_height[f] по смещению offset, 0-100
+static int font_table_score(const uint8_t *data, int offset, int f) {
+    const int h = font_height[f];
+    const uint8_t *table = data + offset;
+    int score = 0;
+
+    // Сплошной блок и пустые глифы
+    score += 15 * solid_bytes(table + 0xDB * h, h) / h;
+    score += is_blank(table, h) ? 10 : 0;
+    score += is_blank(table + 0xFF * h, h) ? 5 : 0;
+
+    // Вертикальная линия: все строки одинаковые и непустые
+    const uint8_t *vline = table + 0xB3 * h;
+    int same = vline[0] != 0;
+    for (int r = 1; r < h && same; r++) {
+        same = vline[r] == vline[0];
+    }
+    score += same ? 10 : 0;
+
+    // Горизонтальная линия: одна или две сплошные строки, остальные пустые
+    const uint8_t *hline = table + 0xC4 * h;
+    int solid = solid_bytes(hline, h);
+    score += (solid >= 1 && solid <= 2 && solid + zero_bytes(hline, h) == h) ? 10 : 0;
+
+    // Печатные символы не пустые
+    const uint8_t *ascii = table + SCORE_ASCII_FIRST * h;
+    int inked = 0;
+    for (int c = 0; c < SCORE_ASCII_COUNT; c++) {
+        inked += !is_blank(ascii + c * h, h);
+    }
+    score += 20 * inked / SCORE_ASCII_COUNT;
+
+    // Соседние строки букв отличаются в среднем на 1-2 бита, у случайных
+    // байт - на 4; пустых строк у букв от 1/8 до 2/3
+    glyph_row_stats_t st;
+    int rows = SCORE_ASCII_COUNT * h;
+    glyph_row_stats(ascii, rows, &st);
+    int change = st.changed_bits * 100 / (rows - 1);     // бит * 100 на строку
+    if (change < 150) {
+        score += 15;
+    } else if (change < 400) {
+        score += 15 * (400 - change) / 250;
+    }
+    if (st.zero_rows * 8 >= rows && st.zero_rows * 3 <= rows * 2) {
+        score += 15;
+    }
+    return score;
+}
+
+static int by_score(const void *a, const void *b) {
+    const font_candidate_t *x = a, *y = b;
+    if (x->score != y->score) {
+        return y->score - x->score;
+    }
+    return x->offset - y->offset;
+}
+
+int rank_font_tables(const uint8_t *data, int data_len, font_candidate_t *cands, int max_cands) {
+    font_candidate_t found[FONT_MAX_CANDIDATES];
+    int nfound = 0;
+
+    for (int f = 0; f < FONT_COUNT; f++) {
+        const int h = font_height[f];
+        for (int offset = 0; offset <= data_len - font_size[f]; offset++) {
+            // Отбор: сплошной 0xDB (кроме двух верхних и двух нижних
+            // строк) и пустой 0x20
+            if (!is_filled(data + offset + 0xDB * h + 2, h - 4, 0xFF) ||
+                !is_blank(data + offset + 0x20 * h, h)) {
+                continue;
+            }
+            int score = font_table_score(data, offset, f);
+            if (score < FONT_MIN_SCORE) {
+                continue;
+            }
+            if (nfound == FONT_MAX_CANDIDATES) {
+                // Место занимает кандидат с наименьшей оценкой
+                qsort(found, nfound, sizeof(*found), by_score);
+                if (found[nfound - 1].score >= score) {
+                    continue;
+                }
+                nfound--;
+            }
+            found[nfound++] = (font_candidate_t){ offset, f, score };
+        }
+    }
+    qsort(found, nfound, sizeof(*found), by_score);
+
+    // Из пересекающихся кандидатов остаётся лучший
+    int n = 0;
+    for (int i = 0; i < nfound && n < max_cands; i++) {
+        int overlap = 0;
+        for (int j = 0; j < n && !overlap; j++) {
+            overlap = found[i].offset < cands[j].offset + font_size[cands[j].font] &&
+                      cands[j].offset < found[i].offset + font_size[found[i].font];
+        }
+        if (!overlap) {
+            cands[n++] = found[i];
+        }
+    }
+    return n;
+}
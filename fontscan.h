@@ -0,0 +1,136 @@
+#ifndef ___FONTSCAN_H___
+#define ___FONTSCAN_H___
+
+#include <stdint.h>
+
+// Размеры шрифтов в байтах
+#define FONT_8X8_SIZE    2048
+#define FONT_8X14_SIZE   3584
+#define FONT_8X16_SIZE   4096
+
+// Таблица шрифта опознаётся по глифу 1 ("смайлик"), первые строки
+// которого 7E 81 A5 81, и по серии нулей перед ним: глиф 0 целиком
+// плюс пустые верхние строки глифа 1
+#define FONT_ANCHOR_LEN    4
+#define FONT_MAX_ANCHORS   64
+
+typedef struct {
+    int pos;        // адрес байта 7E
+    int zeros;      // число нулевых байт перед ним (не больше 18)
+} font_anchor_t;
+
+// Результат первого прохода по образу
+typedef struct {
+    uint8_t sum;            // сумма байт без последнего (контрольного)
+    uint8_t checksum_byte;  // последний байт образа
+    int nanchors;           // FONT_MAX_ANCHORS + 1 при переполнении
+    font_anchor_t anchors[FONT_MAX_ANCHORS];
+} rom_analysis_t;
+
+// Смещения найденных таблиц, -1 - таблица не найдена
+typedef struct {
+    int offset_8x8;
+    int offset_8x14;
+    int offset_8x16;
+} font_layout_t;
+
+// Поиск подпоследовательности signature в data, начиная с позиции
+// search_start_pos. Возвращает позицию первого вхождения или -1.
+// Реализация (AVX2, SSE2 или скалярная) выбирается во время работы.
+int find_signature(const uint8_t *data, int data_len,
+                   const uint8_t *signature, int sig_len, int search_start_pos);
+
+// Простой побайтовый поиск, эталон для векторных версий
+int find_signature_scalar(const uint8_t *data, int data_len,
+                          const uint8_t *signature, int sig_len, int search_start_pos);
+
+#include "cpudetect.h"
+
+#ifdef CPU_X86
+int find_signature_sse2(const uint8_t *data, int data_len,
+                        const uint8_t *signature, int sig_len, int search_start_pos);
+int find_signature_avx2(const uint8_t *data, int data_len,
+                        const uint8_t *signature, int sig_len, int search_start_pos);
+#endif
+
+// Находит все якоря 7E 81 A5 81 за один проход. Возвращает их число;
+// если якорей больше max_hits, возвращает max_hits + 1.
+int scan_font_anchors(const uint8_t *data, int data_len,
+                      font_anchor_t *hits, int max_hits);
+
+// Распределяет якоря по таблицам 8x8/8x14/8x16
+void classify_font_anchors(const uint8_t *data, int data_len,
+                           const font_anchor_t *hits, int nhits,
+                           font_layout_t *layout);
+
+// Поиск всех трёх таблиц шрифтов за один проход по образу
+void locate_fonts(const uint8_t *data, int data_len, font_layout_t *layout);
+
+// Первый проход по образу: перевод в линейный порядок (если
+// odd_offset > 0) или копирование в out, подсчёт суммы байт и поиск
+// якорей шрифтов. Образ обрабатывается блоками, пока они в кэше, так что
+// вход читается и выход пишется по одному разу. Если in == out и
+// odd_offset == 0, данные только просматриваются.
+void analyze_rom(const uint8_t *in, uint8_t *out, int size, int odd_offset,
+                 rom_analysis_t *analysis);
+
+// Поиск таблиц шрифтов по якорям, собранным analyze_rom
+void locate_fonts_analyzed(const uint8_t *data, int data_len,
+                           const rom_analysis_t *analysis, font_layout_t *layout);
+
+// Проверяет, что по найденным ранее смещениям стоят таблицы шрифтов
+// (серия нулей и якорь, а без них - оценка не ниже FONT_ACCEPT_SCORE).
+// Возвращает 1, если все заданные таблицы на месте.
+int verify_font_layout(const uint8_t *data, int data_len, const font_layout_t *layout);
+
+// Сумма байт по модулю 256
+uint8_t byte_sum(const uint8_t *data, int len);
+
+// Название реализации, которую выбирает find_signature
+const char *find_signature_impl(void);
+
+// Наименьшее расстояние Хэмминга (число отличающихся бит) от 16 байт
+// window до n глифов по 16 байт, записанных в glyphs подряд; 255 при
+// n == 0. Реализация (AVX2, popcnt или скалярная) выбирается во время работы.
+int glyph_distance_min(const uint8_t *window, const uint8_t *glyphs, int n);
+int glyph_distance_min_scalar(const uint8_t *window, const uint8_t *glyphs, int n);
+
+#ifdef CPU_X86
+int glyph_distance_min_popcnt(const uint8_t *window, const uint8_t *glyphs, int n);
+int glyph_distance_min_avx2(const uint8_t *window, const uint8_t *glyphs, int n);
+#endif
+
+// Название реализации, которую выбирает glyph_distance_min
+const char *glyph_distance_impl(void);
+
+// Статистика строк глифов для эвристического поиска таблиц
+typedef struct {
+    int zero_rows;          // нулевые байты-строки
+    int changed_bits;       // сумма отличающихся бит соседних строк
+} glyph_row_stats_t;
+
+void glyph_row_stats(const uint8_t *rows, int len, glyph_row_stats_t *stats);
+void glyph_row_stats_scalar(const uint8_t *rows, int len, glyph_row_stats_t *stats);
+
+#ifdef CPU_X86
+void glyph_row_stats_avx2(const uint8_t *rows, int len, glyph_row_stats_t *stats);
+#endif
+
+// Кандидат в таблицу шрифта, найденный без сигнатуры
+#define FONT_MAX_CANDIDATES 64
+#define FONT_MIN_SCORE      50      // меньшие оценки не возвращаются
+#define FONT_ACCEPT_SCORE   80      // таблица без сигнатуры принимается с такой оценки
+
+typedef struct {
+    int offset;
+    int font;               // 0 - 8x8, 1 - 8x14, 2 - 8x16
+    int score;              // уверенность 0-100
+} font_candidate_t;
+
+// Поиск таблиц 8x8/8x14/8x16 по структуре глифов, без глифа 1. Каждое
+// смещение оценивается для каждой высоты; пересекающиеся кандидаты
+// отбрасываются, кроме лучшего. Возвращает до max_cands кандидатов
+// по убыванию оценки.
+int rank_font_tables(const uint8_t *data, int data_len, font_candidate_t *cands, int max_cands);
+
+#endif // ___FONTSCAN_H___
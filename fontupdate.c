@@ -7,28 +7,31 @@
 #include <getopt.h>
 #include <string.h>
 #include <stdint.h>
-#include "fnt_def.h"
+#include <dirent.h>
+#include <errno.h>
+#include <time.h>
+#include "vgarom.h"
+#include "fontderive.h"
+#include "fontreg.h"
+#include "workpool.h"
+#include "serve.h"
+#include "fontcache.h"
+#include "rescache.h"
+#include "layoutidx.h"
+#include "romstats.h"
+#include "rompatch.h"
 
 #define DEFAULT_OUTPUT "upd.rom"
+#define DEFAULT_BATCH_DIR "upd"
+#define MAX_MANIFEST_ARGS 32
+#define DEFAULT_CACHE_MAX_MB 256
+#define RESULT_CACHE_VERSION 4    // увеличить при изменении обработки образа или ключа (result_key)
 
-// Размеры шрифтов в байтах
-#define FONT_8X8_SIZE    2048
-#define FONT_8X14_SIZE   3584
-#define FONT_8X16_SIZE   4096
-#define CHAR_SIZE_8X16   16    // размер одного символа 8x16
-
-// Магические сигнатуры для поиска шрифтов
-const uint8_t FONT_8X8_SIGNATURE[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x81, 0xA5, 0x81
-};
-const uint8_t FONT_8X14_SIGNATURE[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x81, 0xA5, 0x81
-};
-const uint8_t FONT_8X16_SIGNATURE[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x81, 0xA5, 0x81
-};
+// В пакетном режиме подробный вывод отдельных заданий отключается,
+// чтобы сообщения из разных потоков не перемешивались. Аргументы info()
+// при этом не вычисляются, поэтому у них не должно быть побочных эффектов.
+static int quiet = 0;
+#define info(...) do { if (!quiet) printf(__VA_ARGS__); } while (0)
 
 // Структура для хранения опций командной строки
 typedef struct {
@@ -39,11 +42,34 @@ typedef struct {
     char *dosfont_8x16;    // новая опция
     char *output_rom;
     char *save_pattern;
+    char *batch;           // манифест или каталог для пакетного режима
+    char *serve;           // сокет для режима сервера
+    char *variants;        // список наборов шрифтов для одного образа
+    char *cache_dir;       // каталог кэша результатов
+    long cache_max_mb;     // предельный размер кэша
+    char *index;           // файл индекса разметки
+    char *fontlib;         // библиотека шрифтов для имён @шрифт
+    int detect;            // только вывести кандидатов в таблицы шрифтов
+    char *stats;           // файл статистики в JSON
+    char *apply;           // патч, применяемый к входу
+    int patch;             // ROMPATCH_* - писать патч вместо образа
+    int jobs;              // число потоков пакетного режима
+    int fuzzy;             // допустимое число отличающихся бит глифа DOS-шрифта
+    int derive;            // строить незаданные 8x8 и 8x14 из шрифта 8x16
     int is_normal;
     int output_normal;
-    int default_fnt;
+    const char *default_fnt;   // имя встроенного шрифта, NULL - не задан
 } options_t;
 
+// Одно задание пакетного режима
+typedef struct {
+    options_t opts;
+    char *args;            // строка манифеста, на которую ссылается opts
+    char *input_path;      // пути, построенные при обходе каталога
+    char *output_path;
+    int status;
+} batch_job_t;
+
 #ifdef __DEBUG__
 int save_tmp_debfile(char *filename, int filesize, uint8_t *data) {
     int fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
@@ -61,82 +87,6 @@ int save_tmp_debfile(char *filename, int filesize, uint8_t *data) {
 }
 #endif //__DEBUG__
 
-// Функция для нормализации данных ROM
-void odd_even_to_linear(uint8_t *in, uint8_t *out, int size) {
-    for (int i = 0; i < size; i++) {
-        if (i % 2) {
-            out[i] = in[i/2 + 0x4000];
-        } else {
-            out[i] = in[i/2];
-        }
-    }
-}
-
-// Функция для обратного преобразования
-void linear_to_odd_even(uint8_t *in, uint8_t *out, int size) {
-    for (int i = 0; i < size; i++) {
-        if (i % 2) {
-            out[i/2 + 0x4000] = in[i];
-        } else {
-            out[i/2] = in[i];
-        }
-    }
-}
-
-// Функция для поиска подпоследовательности в массиве
-int find_signature(uint8_t *data, int data_len,
-                   const uint8_t *signature, int sig_len, int search_start_pos) {
-    for (int i = search_start_pos; i <= data_len - sig_len; i++) {
-        int found = 1;
-        for (int j = 0; j < sig_len; j++) {
-            if (data[i + j] != signature[j]) {
-                found = 0;
-                break;
-            }
-        }
-        if (found) {
-            return i;
-        }
-    }
-    return -1;
-}
-
-// Функция для загрузки файла шрифта
-uint8_t *load_font_file(const char *filename, int *size) {
-    struct stat st;
-    int fd;
-    uint8_t *data;
-
-    if (stat(filename, &st) != 0) {
-        perror("Error getting font file size");
-        return NULL;
-    }
-
-    *size = st.st_size;
-    fd = open(filename, O_RDONLY);
-    if (fd == -1) {
-        perror("Error opening font file");
-        return NULL;
-    }
-
-    data = malloc(*size);
-    if (data == NULL) {
-        perror("Memory allocation failed");
-        close(fd);
-        return NULL;
-    }
-
-    if (read(fd, data, *size) != *size) {
-        perror("Error reading font file");
-        free(data);
-        close(fd);
-        return NULL;
-    }
-
-    close(fd);
-    return data;
-}
-
 static int save_font(uint8_t *font_data, size_t font_size, const char *pattern, const char *size_suffix) {
     char filename[256];
 
@@ -160,84 +110,21 @@ static int save_font(uint8_t *font_data, size_t font_size, const char *pattern,
         return -1;
     }
 
-    printf("Original font saved to %s\n", filename);
+    info("Original font saved to %s\n", filename);
     return 0;
 }
 
-// Функция для обновления контрольной суммы ROM
-void update_checksum(uint8_t *data, int size) {
-    uint8_t sum = 0;
-
-    for (int i = 0; i < size - 1; i++) {
-        sum += data[i];
+// Список встроенных шрифтов
+static void print_builtin_fonts(void) {
+    printf("Built-in fonts:");
+    for (int i = 0; i < fontreg_count(); i++) {
+        printf(" %s", fontreg_name(i));
     }
-
-    data[size - 1] = (uint8_t)(0x100 - sum);
-    printf("Updated checksum to: 0x%02X\n", data[size - 1]);
+    printf("%s\n", fontreg_count() > 0 ? "" : " none");
 }
 
-// Новая функция для поиска и замены паттернов DOS-шрифта
-void find_and_replace_patterns(uint8_t *rom_data, int rom_size,
-                               uint8_t *fontrom, int fontrom_offset,
-                               uint8_t *dosfont, uint8_t *newfont,
-                               int font_size) {
-    int patterns_found = 0;
-    int patterns_replaced = 0;
-    int max_chars = font_size / CHAR_SIZE_8X16;
-
-    if (max_chars > 256) max_chars = 256; // ограничиваем 256 символами
-
-    printf("\nSearching for DOS font patterns...\n");
-
-    // Для каждого символа
-    for (int char_idx = 0; char_idx < max_chars; char_idx++) {
-        uint8_t *fontrom_char = fontrom + (char_idx * CHAR_SIZE_8X16);
-        uint8_t *dosfont_char = dosfont + (char_idx * CHAR_SIZE_8X16);
-
-        // Проверяем, не выходим ли за границы
-        if ((char_idx * CHAR_SIZE_8X16 + CHAR_SIZE_8X16) > font_size) {
-            break;
-        }
-
-        // Сравниваем паттерны символа
-        if (memcmp(fontrom_char, dosfont_char, CHAR_SIZE_8X16) != 0) {
-            patterns_found++;
-
-            // Ищем паттерн во всем ROM, кроме области основного шрифта
-            uint8_t *search_ptr = rom_data;
-            uint8_t *end_ptr = rom_data + rom_size - CHAR_SIZE_8X16;
-            uint8_t *fontrom_start = rom_data + fontrom_offset;
-            uint8_t *fontrom_end = fontrom_start + font_size;
-
-            while (search_ptr <= end_ptr) {
-                // Пропускаем область основного шрифта
-                if (search_ptr >= fontrom_start && search_ptr < fontrom_end) {
-                    search_ptr = fontrom_end;
-                    continue;
-                }
-
-                if (memcmp(search_ptr, dosfont_char, CHAR_SIZE_8X16) == 0) {
-                    // Нашли паттерн - заменяем на символ из нового шрифта
-                    uint8_t *newfont_char = newfont + (char_idx * CHAR_SIZE_8X16);
-
-                    // Проверяем, не выходит ли новый символ за границы
-                    if ((char_idx * CHAR_SIZE_8X16 + CHAR_SIZE_8X16) <= font_size) {
-                        memcpy(search_ptr, newfont_char, CHAR_SIZE_8X16);
-                        patterns_replaced++;
-                    }
-
-                    search_ptr += CHAR_SIZE_8X16; // Переходим к следующему блоку
-                } else {
-                    search_ptr++;
-                }
-            }
-        }
-    }
-
-    printf("  Characters compared: %d\n", max_chars);
-    printf("  Non-matching patterns found: %d\n", patterns_found);
-    printf("  Patterns replaced in ROM: %d\n", patterns_replaced);
-}
+static const char *const font_names[VGAROM_FONT_COUNT] = { "8x8", "8x14", "8x16" };
+static const char *const alt_names[VGAROM_ALT_COUNT] = { "9x14", "9x16" };
 
 // Функция для вывода справки
 void print_help() {
@@ -245,50 +132,82 @@ void print_help() {
     printf("Update fonts in VGA BIOS ROM files.\n\n");
     printf("Options:\n");
     printf("  -i, --input <file>   Input ROM file (required)\n");
-    printf("  -d, --default        Use default fonts. Font files are ignored\n");
+    printf("  -d, --default[=name] Use a built-in font (default: %s). Font files are ignored\n",
+           fontreg_count() > 0 ? fontreg_name(fontreg_find(NULL)) : "none");
     printf("  -8, --f8 <file>      8x8 font file\n");
     printf("  -4, --f14 <file>     8x14 font file\n");
     printf("  -6, --f16 <file>     8x16 font file\n");
     printf("  -f, --fontdos <file> DOS 8x16 font file for pattern matching\n");
+    printf("      --fuzzy=<bits>   Also match DOS glyph copies that differ by up to <bits> bits\n"
+           "                       (0-%d, 0 - exact matches only, the default)\n",
+           VGAROM_MAX_FUZZY_BITS);
+    printf("      --derive         Build the 8x8 and 8x14 fonts that are not given from the 8x16 font\n");
     printf("  -o, --output <file>  Output ROM file (default: %s)\n", DEFAULT_OUTPUT);
     printf("  -s, --save[=pattern] Save original fonts with optional name pattern\n");
     printf("  -n, --normal         The input ROM image has a linear byte arrangement\n");
     printf("  -m, --mix            The output ROM image will have the following order:\n\t\todd at the beginning, even in the middle\n");
+    printf("  -b, --batch <path>   Batch mode: process a manifest file or every ROM in a directory\n");
+    printf("  -j, --jobs <n>       Number of worker threads in batch mode (default: CPU count)\n");
+    printf("      --serve <socket> Server mode: process ROMs sent over a Unix socket\n");
+    printf("      --variants <file> Build one output per font set listed in the file from a single analysis of the input ROM\n");
+    printf("      --cache <dir>    Reuse results of earlier runs with the same ROM, fonts and options\n");
+    printf("      --cache-max <MB> Result cache size limit (default: %d)\n", DEFAULT_CACHE_MAX_MB);
+    printf("      --index <file>   Keep font offsets and DOS pattern hits of processed ROMs in a layout index\n");
+    printf("      --fontlib <file> Font library made by utils/fontpack; font arguments @name refer to it\n");
+    printf("      --detect         List font table candidates found by glyph structure and exit\n");
+    printf("      --stats <file>   Append a JSON line with phase timings and counters per ROM (- for stdout; other output then goes to stderr)\n");
+    printf("      --patch <fmt>    Write an ips or bps patch against the input ROM instead of the ROM\n");
+    printf("      --apply <patch>  Apply an IPS or BPS patch to the input ROM and write the result\n");
     printf("  -h, --help           Display this help message\n\n");
     printf("If any font file is not specified, that font will not be replaced.\n");
     printf("By default, even and odd (shuffled) data is expected to be interleaved in ROM.\n");
     printf("The --dosfont option enables pattern matching: finds characters that\n");
     printf("differ between ROM and DOS font and replaces their occurrences elsewhere\n");
-    printf("in the ROM before updating the main font.\n");
+    printf("in the ROM before updating the main font.\n\n");
+    printf("In batch mode with a directory, every file in it is processed with the\n");
+    printf("options from the command line and written to the --output directory\n");
+    printf("(default: %s). A manifest has one job per line in the same option syntax,\n", DEFAULT_BATCH_DIR);
+    printf("e.g. \"-i card.bin -6 font.fnt -o card_rus.bin\"; command line options\n");
+    printf("are used as defaults for every line. Lines starting with # are ignored.\n\n");
+    printf("In server mode a request is a line \"<rom size> [options]\" followed by\n");
+    printf("the ROM image; options use the manifest syntax without -i, -o and -s.\n");
+    printf("The reply is \"OK <size>\" and the processed image, or \"ERR <message>\".\n");
+    printf("Fonts stay loaded between requests.\n\n");
+    printf("A variants file lists one font set per line in the manifest syntax with -o,\n");
+    printf("e.g. \"-6 font.fnt -o card_font.bin\"; -i, -f, -n and -s come from the command line.\n\n");
+    print_builtin_fonts();
     exit(0);
 }
 
-// Функция для разбора параметров командной строки
-options_t parse_options(int argc, char *argv[]) {
-    options_t opts = {
-        .input_rom = NULL,
-        .font_8x8 = NULL,
-        .font_8x14 = NULL,
-        .font_8x16 = NULL,
-        .dosfont_8x16 = NULL,
-        .output_rom = DEFAULT_OUTPUT,
-        .save_pattern = NULL,
-        .is_normal = 0,
-        .output_normal = 1,
-        .default_fnt = 0
-    };
-
+// Разбор параметров поверх уже заполненной структуры opts.
+// Используется и для командной строки, и для строк манифеста.
+// Возвращает 0, -1 при ошибке или 1, если запрошена справка.
+static int parse_args(int argc, char *argv[], options_t *opts) {
     struct option long_options[] = {
         {"input",   required_argument, 0, 'i'},
-        {"default", no_argument,       0, 'd'},
+        {"default", optional_argument, 0, 'd'},
         {"f8",      required_argument, 0, '8'},
         {"f14",     required_argument, 0, '4'},
         {"f16",     required_argument, 0, '6'},
         {"fontdos", required_argument, 0, 'f'},
+        {"fuzzy",   required_argument, 0, 'F'},
+        {"derive",  no_argument,       0, 'R'},
         {"output",  required_argument, 0, 'o'},
         {"save",    optional_argument, 0, 's'},
         {"normal",  no_argument,       0, 'n'},
         {"mix",     no_argument,       0, 'm'},
+        {"batch",   required_argument, 0, 'b'},
+        {"jobs",    required_argument, 0, 'j'},
+        {"serve",   required_argument, 0, 'S'},
+        {"variants", required_argument, 0, 'V'},
+        {"cache",   required_argument, 0, 'C'},
+        {"cache-max", required_argument, 0, 'M'},
+        {"index",   required_argument, 0, 'X'},
+        {"fontlib", required_argument, 0, 'L'},
+        {"detect",  no_argument,       0, 'D'},
+        {"stats",   required_argument, 0, 'T'},
+        {"patch",   required_argument, 0, 'P'},
+        {"apply",   required_argument, 0, 'A'},
         {"help",    no_argument,       0, 'h'},
         {0, 0, 0, 0}
     };
@@ -296,47 +215,148 @@ options_t parse_options(int argc, char *argv[]) {
     int opt;
     int option_index = 0;
 
-    while ((opt = getopt_long(argc, argv, "i:do:8:4:6:f:s::nmh",
+    optind = 0; // getopt может вызываться повторно для строк манифеста
+    while ((opt = getopt_long(argc, argv, "i:d::o:8:4:6:f:s::nmb:j:h",
                               long_options, &option_index)) != -1) {
         switch (opt) {
             case 'i':
-                opts.input_rom = optarg;
+                opts->input_rom = optarg;
                 break;
-            case 'd':
-                opts.default_fnt = 1;
+            case 'd': {
+                int idx = fontreg_find(optarg);
+                if (idx < 0) {
+                    fprintf(stderr, "Error: Unknown built-in font '%s'\n", optarg ? optarg : "");
+                    print_builtin_fonts();
+                    return -1;
+                }
+                opts->default_fnt = fontreg_name(idx);
                 break;
+            }
             case '8':
-                opts.font_8x8 = optarg;
+                opts->font_8x8 = optarg;
                 break;
             case '4':
-                opts.font_8x14 = optarg;
+                opts->font_8x14 = optarg;
                 break;
             case '6':
-                opts.font_8x16 = optarg;
+                opts->font_8x16 = optarg;
                 break;
             case 'f':
-                opts.dosfont_8x16 = optarg;
+                opts->dosfont_8x16 = optarg;
+                break;
+            case 'F': {
+                char *end;
+                long bits = strtol(optarg, &end, 10);
+                if (*end != '\0' || bits < 0 || bits > VGAROM_MAX_FUZZY_BITS) {
+                    fprintf(stderr, "Error: --fuzzy takes a number of bits from 0 to %d\n",
+                            VGAROM_MAX_FUZZY_BITS);
+                    return -1;
+                }
+                opts->fuzzy = bits;
+                break;
+            }
+            case 'R':
+                opts->derive = 1;
                 break;
             case 'o':
-                opts.output_rom = optarg;
+                opts->output_rom = optarg;
                 break;
             case 's':
-                opts.save_pattern = optarg ? optarg : "";
+                opts->save_pattern = optarg ? optarg : "";
                 break;
             case 'n':
-                opts.is_normal = 1;
+                opts->is_normal = 1;
                 break;
             case 'm':
-                opts.output_normal = 0;
+                opts->output_normal = 0;
+                break;
+            case 'b':
+                opts->batch = optarg;
+                break;
+            case 'j':
+                opts->jobs = atoi(optarg);
+                break;
+            case 'S':
+                opts->serve = optarg;
+                break;
+            case 'V':
+                opts->variants = optarg;
+                break;
+            case 'C':
+                opts->cache_dir = optarg;
+                break;
+            case 'M':
+                opts->cache_max_mb = atol(optarg);
+                break;
+            case 'X':
+                opts->index = optarg;
+                break;
+            case 'L':
+                opts->fontlib = optarg;
+                break;
+            case 'D':
+                opts->detect = 1;
+                break;
+            case 'T':
+                opts->stats = optarg;
+                break;
+            case 'P':
+                opts->patch = rompatch_format(optarg);
+                if (opts->patch == ROMPATCH_NONE) {
+                    fprintf(stderr, "Error: Unknown patch format '%s'\n", optarg);
+                    return -1;
+                }
+                break;
+            case 'A':
+                opts->apply = optarg;
                 break;
             case 'h':
+                return 1;
             default:
-                print_help();
-                break;
+                return -1;
         }
     }
+    if (optind < argc) {
+        fprintf(stderr, "Error: Unexpected argument '%s'\n", argv[optind]);
+        return -1;
+    }
+    return 0;
+}
+
+// Функция для разбора параметров командной строки
+options_t parse_options(int argc, char *argv[]) {
+    options_t opts = {
+        .input_rom = NULL,
+        .font_8x8 = NULL,
+        .font_8x14 = NULL,
+        .font_8x16 = NULL,
+        .dosfont_8x16 = NULL,
+        .output_rom = NULL,
+        .save_pattern = NULL,
+        .batch = NULL,
+        .serve = NULL,
+        .variants = NULL,
+        .cache_dir = NULL,
+        .cache_max_mb = DEFAULT_CACHE_MAX_MB,
+        .index = NULL,
+        .fontlib = NULL,
+        .detect = 0,
+        .stats = NULL,
+        .apply = NULL,
+        .patch = ROMPATCH_NONE,
+        .jobs = 0,
+        .fuzzy = 0,
+        .derive = 0,
+        .is_normal = 0,
+        .output_normal = 1,
+        .default_fnt = NULL
+    };
+
+    if (parse_args(argc, argv, &opts) != 0) {
+        print_help();
+    }
 
-    if (opts.input_rom == NULL) {
+    if (opts.input_rom == NULL && opts.batch == NULL && opts.serve == NULL) {
         fprintf(stderr, "Error: Input ROM file is required\n");
         print_help();
     }
@@ -344,77 +364,137 @@ options_t parse_options(int argc, char *argv[]) {
     return opts;
 }
 
-int get_filesize(char *filename) {
-    struct stat st;
-    if (stat(filename, &st) != 0) {
-        perror("Error getting input file size");
-        exit(-1);
+// Отображения входного и выходного образов в память
+typedef struct {
+    uint8_t *in;           // входной файл, MAP_PRIVATE
+    uint8_t *out;          // выходной файл, MAP_SHARED
+    int size;
+    int mappings;          // число созданных отображений
+} rom_io_t;
+
+static void rom_io_close(rom_io_t *io) {
+    if (io->in && io->in != MAP_FAILED) {
+        munmap(io->in, io->size);
+    }
+    if (io->out && io->out != MAP_FAILED) {
+        munmap(io->out, io->size);
     }
-    return st.st_size;
+    io->in = io->out = NULL;
 }
 
-uint8_t *read_rom_file(char *input_file, int filesize) {
-    printf("Input ROM: %s (size: %d bytes)\n", input_file, filesize);
-
-    uint8_t *rom_data = malloc(filesize);
-    if (!rom_data) {
-        perror("Memory allocation failed");
-        exit(-1);
-    }
+// Отображает входной образ только для чтения с копированием при записи.
+// Страницы копируются, только если в них что-то записать.
+static int rom_io_open_input(rom_io_t *io, const char *input_file, struct stat *st) {
+    memset(io, 0, sizeof(*io));
 
     int fd = open(input_file, O_RDONLY);
     if (fd == -1) {
         perror("Error opening input file");
-        free(rom_data);
-        exit(-1);
+        return -1;
     }
-
-    if (read(fd, rom_data, filesize) != filesize) {
-        perror("Error reading input file");
+    if (fstat(fd, st) != 0) {
+        perror("Error getting input file size");
+        close(fd);
+        return -1;
+    }
+    if (st->st_size < 2) {
+        fprintf(stderr, "Error: Input file %s is too small\n", input_file);
         close(fd);
-        free(rom_data);
-        exit(-1);
+        return -1;
     }
+    io->size = st->st_size;
+    info("Input ROM: %s (size: %d bytes)\n", input_file, io->size);
 
+    io->in = mmap(NULL, io->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
     close(fd);
-    return rom_data;
+    if (io->in == MAP_FAILED) {
+        perror("Error mapping input file");
+        io->in = NULL;
+        return -1;
+    }
+    io->mappings++;
+    return 0;
 }
 
-void write_rom_file(char *output_file, uint8_t *output_data, int filesize) {
-    int fd = open(output_file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+// Создаёт выходной файл нужного размера и отображает его в память
+static int rom_io_open_output(rom_io_t *io, const char *output_file, const struct stat *in_st) {
+    int fd = open(output_file, O_RDWR | O_CREAT, 0644);
     if (fd == -1) {
         perror("Error opening output file");
-        free(output_data);
-        exit(-1);
+        return -1;
     }
 
-    if (write(fd, output_data, filesize) != filesize) {
-        perror("Error writing output file");
+    // Запись в тот же файл изменила бы ещё не скопированные страницы входа,
+    // поэтому в этом случае вход сначала копируется целиком
+    struct stat out_st;
+    if (fstat(fd, &out_st) == 0 && out_st.st_dev == in_st->st_dev && out_st.st_ino == in_st->st_ino) {
+        uint8_t *copy = mmap(NULL, io->size, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (copy == MAP_FAILED) {
+            perror("Memory allocation failed");
+            close(fd);
+            return -1;
+        }
+        memcpy(copy, io->in, io->size);
+        munmap(io->in, io->size);
+        io->in = copy;
+        io->mappings++;
+    }
+
+    // Файл с другими жёсткими ссылками (например, из кэша результатов
+    // прежних версий) заменяется новым, чтобы не испортить остальные ссылки
+    if (out_st.st_nlink > 1) {
         close(fd);
-        free(output_data);
-        exit(-1);
+        if (unlink(output_file) != 0) {
+            perror("Error replacing output file");
+            return -1;
+        }
+        fd = open(output_file, O_RDWR | O_CREAT, 0644);
+        if (fd == -1) {
+            perror("Error opening output file");
+            return -1;
+        }
     }
 
+    if (ftruncate(fd, io->size) != 0) {
+        perror("Error resizing output file");
+        close(fd);
+        return -1;
+    }
+    io->out = mmap(NULL, io->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
     close(fd);
+    if (io->out == MAP_FAILED) {
+        perror("Error mapping output file");
+        io->out = NULL;
+        return -1;
+    }
+    io->mappings++;
+    return 0;
 }
 
-void replace_font(uint8_t *working_data, const char *font_path,
-                  int offset, int expected_size, const char *font_name, uint8_t * fnt) {
+// Возвращает 1, если таблица заменена. derived_from - источник шрифта
+// 8x16, из которого построен fnt (--derive), для сообщения.
+int replace_font(vgarom_t *rom, const char *font_path,
+                 int font, const char *font_name, const uint8_t *fnt,
+                 const char *derived_from) {
     int font_size;
-    uint8_t *font_data;
+    int expected_size = vgarom_font_size(font);
+    const uint8_t *font_data;
     if (NULL == fnt) {
-        if (!font_path || offset < 0) return;
-        font_data = load_font_file(font_path, &font_size);
-        if (!font_data) return;
+        if (!font_path || rom->font_offset[font] < 0) return 0;
+        font_data = fontcache_get(font_path, &font_size);
+        if (!font_data) return 0;
     } else {
-        if (offset < 0) return;
+        if (rom->font_offset[font] < 0) return 0;
         font_data = fnt;
         font_size = expected_size;
     }
-    if (font_path) {
-        printf("\nReplacing %s font from %s\n", font_name, font_path);
+    if (derived_from) {
+        info("\nReplacing %s font derived from %s\n", font_name, derived_from);
+    } else if (font_path) {
+        info("\nReplacing %s font from %s\n", font_name, font_path);
     } else {
-        printf("\nReplacing %s font from the default font\n", font_name);
+        info("\nReplacing %s font from the default font\n", font_name);
     }
 
     if (font_size != expected_size) {
@@ -422,184 +502,1314 @@ void replace_font(uint8_t *working_data, const char *font_path,
                font_size, expected_size);
     }
 
-    size_t copy_size = (font_size < expected_size) ? font_size : expected_size;
-    memcpy(working_data + offset, font_data, copy_size);
-    if (NULL == fnt) {
-        free(font_data);
+    if (vgarom_replace_font(rom, font, font_data, font_size) != VGAROM_OK) {
+        return 0;
     }
+    // Таблица исправлений перестраивается вместе с таблицей шрифта
+    int alt = font == VGAROM_FONT_8X14 ? VGAROM_ALT_9X14 :
+              font == VGAROM_FONT_8X16 ? VGAROM_ALT_9X16 : -1;
+    if (alt >= 0 && rom->alt[alt].offset >= 0) {
+        info("Regenerated %d glyphs of the %s fix-up table\n",
+             rom->alt[alt].nrecords, alt_names[alt]);
+    }
+    return 1;
 }
 
-int main(int argc, char *argv[]) {
-    options_t opts = parse_options(argc, argv);
+// Поиск вхождений глифов DOS-шрифта. С индексом разметки вхождения
+// берутся из него после проверки, а найденные заново сохраняются.
+// Нечёткий поиск индекс не использует: в нём хранятся только точные
+// вхождения. Возвращает число вхождений или код ошибки.
+static int find_dos_hits(const options_t *opts, const vgarom_t *rom, uint64_t rom_hash,
+                         const uint8_t *dosfont, int dosfont_size,
+                         vgarom_dos_hit_t *hits, vgarom_pattern_stats_t *stats,
+                         romstats_t *st) {
+    int linear = (rom->flags & VGAROM_LINEAR) != 0;
+    int max_hits = VGAROM_MAX_DOS_HITS(rom->size);
+    uint64_t dos_hash = 0;
+    int nhits = -1;
+
+    memset(stats, 0, sizeof(*stats));
+    if (opts->fuzzy > 0) {
+        nhits = vgarom_find_dos_patterns_fuzzy(rom, dosfont, opts->fuzzy, hits, max_hits, stats);
+        for (int i = 0; i < nhits; i++) {
+            if (hits[i].distance > 0) {
+                info("Fuzzy match at 0x%X: char 0x%02X, distance %d\n", hits[i].offset,
+                     hits[i].char_idx, hits[i].distance);
+            }
+        }
+    } else if (opts->index) {
+        dos_hash = fontcache_hash(dosfont, dosfont_size);
+        nhits = layoutidx_get_dos(rom_hash, linear, dos_hash, hits, max_hits);
+        if (nhits >= 0 && vgarom_verify_dos_hits(rom, dosfont, hits, nhits, stats) != VGAROM_OK) {
+            nhits = -1;
+        }
+    }
+    if (nhits < 0 && opts->fuzzy == 0) {
+        nhits = vgarom_find_dos_patterns(rom, dosfont, hits, max_hits, stats);
+        if (opts->index && nhits >= 0) {
+            layoutidx_put_dos(rom_hash, linear, dos_hash, hits, nhits);
+        }
+    }
 
-    int font_8x8_offset = -1, font_8x14_offset = -1, font_8x16_offset = -1;
-    int filesize = get_filesize(opts.input_rom);
+    st->bytes_scanned += stats->bytes_scanned;
+    st->glyph_compares += stats->compares;
+    st->candidates += stats->candidates;
+    st->fuzzy_hits += stats->fuzzy_hits;
+    return nhits;
+}
 
-    // Читаем ROM
-    uint8_t *rom_data = read_rom_file(opts.input_rom, filesize);
-    uint8_t *working_data = NULL;
-    uint8_t *output_data = NULL;
+// Поиск и замена паттернов DOS-шрифта
+static void replace_dos_patterns(const options_t *opts, vgarom_t *rom, uint64_t rom_hash,
+                                 const uint8_t *dosfont, int dosfont_size,
+                                 const uint8_t *newfont, vgarom_pattern_stats_t *stats,
+                                 romstats_t *st) {
+    vgarom_dos_hit_t *hits = malloc(VGAROM_MAX_DOS_HITS(rom->size) * sizeof(*hits));
 
-    // Подготавливаем working_data в зависимости от типа ROM
-    if (opts.is_normal) {
-        working_data = rom_data;
-        printf("Using normal (linear) font layout\n");
+    if (!hits) {
+        memset(stats, 0, sizeof(*stats));
+        perror("Memory allocation failed");
+        return;
+    }
+    st->allocations++;
+
+    int nhits = find_dos_hits(opts, rom, rom_hash, dosfont, dosfont_size, hits, stats, st);
+    if (nhits >= 0) {
+        vgarom_apply_dos_patterns(rom, hits, nhits, newfont);
+        st->pattern_replacements += nhits;
+    }
+    free(hits);
+}
+
+// Поиск таблиц шрифтов. Разметка берётся из индекса, если сигнатуры по
+// сохранённым смещениям на месте, иначе определяется по якорям из
+// первого прохода. Возвращает хеш образа для индекса (0 без индекса).
+static uint64_t detect_fonts(const options_t *opts, vgarom_t *rom) {
+    int linear = (rom->flags & VGAROM_LINEAR) != 0;
+    uint64_t rom_hash = 0;
+    int offsets[VGAROM_FONT_COUNT];
+    int alt_offsets[VGAROM_ALT_COUNT];
+
+    if (opts->index) {
+        rom_hash = fontcache_hash(rom->data, rom->size);
+    }
+    if (opts->index && layoutidx_get_fonts(rom_hash, linear, rom->size, offsets, alt_offsets) == 0 &&
+        vgarom_set_fonts(rom, offsets) == VGAROM_OK &&
+        vgarom_set_alt_tables(rom, alt_offsets) == VGAROM_OK) {
+        info("Font layout taken from index %s\n", opts->index);
     } else {
-        working_data = malloc(filesize);
-        if (!working_data) {
-            perror("Memory allocation failed");
-            free(rom_data);
-            exit(-1);
+        vgarom_locate_fonts(rom);
+        if (opts->index) {
+            for (int alt = 0; alt < VGAROM_ALT_COUNT; alt++) {
+                alt_offsets[alt] = rom->alt[alt].offset;
+            }
+            layoutidx_put_fonts(rom_hash, linear, rom->size, rom->font_offset, alt_offsets);
         }
-        odd_even_to_linear(rom_data, working_data, filesize);
-        printf("Converting from odd/even to linear layout\n");
     }
-
-    if ((0x55 != working_data[0]) || (0xAA != working_data[1])) {
-        printf("\nWarning! The image is not a BIOS ROM\n");
-        printf("Check the correctness of the selection of alternation of even and odd data in ROM.\n");
-        if (working_data != rom_data) {
-            free(working_data);
+    info("\nFont positions found:\n");
+    for (int font = 0; font < VGAROM_FONT_COUNT; font++) {
+        int offset = rom->font_offset[font];
+        char label[8];
+        snprintf(label, sizeof(label), "%s:", font_names[font]);
+        info("  %-5s %s (0x%X)", label, offset >= 0 ? "Found" : "Not found", offset);
+        if (rom->font_score[font] > 0) {
+            info(" by glyph structure, confidence %d%%", rom->font_score[font]);
         }
-        free(rom_data);
-        exit(-1);
+        info("\n");
     }
+    if (rom->int10_handler >= 0) {
+        info("  Taken from the INT 10h/1130h font pointers (handler at 0x%X)\n",
+             rom->int10_handler);
+    }
+    for (int alt = 0; alt < VGAROM_ALT_COUNT; alt++) {
+        if (rom->alt[alt].offset >= 0) {
+            info("  %s fix-up table at 0x%X, %d characters\n", alt_names[alt],
+                 rom->alt[alt].offset, rom->alt[alt].nrecords);
+        }
+    }
+    return rom_hash;
+}
 
-    #ifdef __DEBUG__
-    save_tmp_debfile("normalize.dat", filesize, working_data);
-    #endif
-
-    // Ищем шрифты по сигнатурам
-    int search_start_offset = 0;
+// Сохраняет оригинальные шрифты (-s)
+static void save_fonts(const options_t *opts, const vgarom_t *rom) {
+    int font_8x8_offset = rom->font_offset[VGAROM_FONT_8X8];
+    int font_8x14_offset = rom->font_offset[VGAROM_FONT_8X14];
+    int font_8x16_offset = rom->font_offset[VGAROM_FONT_8X16];
 
-    font_8x8_offset = find_signature(working_data, filesize,
-                                     FONT_8X8_SIGNATURE,
-                                     sizeof(FONT_8X8_SIGNATURE), search_start_offset);
     if (font_8x8_offset >= 0) {
-        search_start_offset = font_8x8_offset + FONT_8X8_SIZE;
+        save_font(rom->data + font_8x8_offset, FONT_8X8_SIZE,
+                 opts->save_pattern, "8x8");
     }
-
-    font_8x14_offset = find_signature(working_data, filesize,
-                                      FONT_8X14_SIGNATURE,
-                                      sizeof(FONT_8X14_SIGNATURE), search_start_offset);
     if (font_8x14_offset >= 0) {
-        search_start_offset = font_8x14_offset + FONT_8X14_SIZE;
+        save_font(rom->data + font_8x14_offset, FONT_8X14_SIZE,
+                 opts->save_pattern, "8x14");
     }
+    if (font_8x16_offset >= 0) {
+        save_font(rom->data + font_8x16_offset, FONT_8X16_SIZE,
+                 opts->save_pattern, "8x16");
+    }
+}
 
-    font_8x16_offset = find_signature(working_data, filesize,
-                                      FONT_8X16_SIGNATURE,
-                                      sizeof(FONT_8X16_SIGNATURE), search_start_offset);
+// Таблица встроенного шрифта, выбранного -d; NULL - у шрифта её нет
+static const uint8_t *default_table(const options_t *opts, int font) {
+    return fontreg_table(fontreg_find(opts->default_fnt), font);
+}
 
-    printf("\nFont positions found:\n");
-    printf("  8x8:  %s (0x%X)\n",
-           font_8x8_offset >= 0 ? "Found" : "Not found",
-           font_8x8_offset);
-    printf("  8x14: %s (0x%X)\n",
-           font_8x14_offset >= 0 ? "Found" : "Not found",
-           font_8x14_offset);
-    printf("  8x16: %s (0x%X)\n",
-           font_8x16_offset >= 0 ? "Found" : "Not found",
-           font_8x16_offset);
+// DOS-шрифт для поиска паттернов. Поиск и замена читают из шрифтов
+// FONT_8X16_SIZE байт, так что более короткий шрифт - ошибка.
+static const uint8_t *load_dosfont(const options_t *opts, int *size) {
+    const uint8_t *data = fontcache_get(opts->dosfont_8x16, size);
 
-    // Сохраняем оригинальные шрифты если нужно
-    if (opts.save_pattern != NULL) {
-        if (font_8x8_offset >= 0) {
-            save_font(working_data + font_8x8_offset, FONT_8X8_SIZE,
-                     opts.save_pattern, "8x8");
-        }
-        if (font_8x14_offset >= 0) {
-            save_font(working_data + font_8x14_offset, FONT_8X14_SIZE,
-                     opts.save_pattern, "8x14");
-        }
-        if (font_8x16_offset >= 0) {
-            save_font(working_data + font_8x16_offset, FONT_8X16_SIZE,
-                     opts.save_pattern, "8x16");
-        }
+    if (data && *size < FONT_8X16_SIZE) {
+        fprintf(stderr, "Error: DOS font file size (%d) is smaller than expected (%d)\n",
+                *size, FONT_8X16_SIZE);
+        return NULL;
     }
+    return data;
+}
 
-    // Обработка DOS-шрифта (поиск и замена паттернов ДО замены основного шрифта)
-    if ((opts.dosfont_8x16 && font_8x16_offset >= 0 && opts.font_8x16) || opts.default_fnt) {
-        int dosfont_size;
-        uint8_t *dosfont_data = load_font_file(opts.dosfont_8x16, &dosfont_size);
-
-        if (dosfont_data) {
-            if (dosfont_size < FONT_8X16_SIZE) {
-                printf("Warning: DOS font file size (%d) is smaller than expected (%d)\n",
-                       dosfont_size, FONT_8X16_SIZE);
-            }
-
-            // Загружаем новый шрифт
-            int newfont_size;
-            uint8_t *newfont_data;
-            if (!opts.default_fnt) {
-                newfont_data = load_font_file(opts.font_8x16, &newfont_size);
-            } else {
-                newfont_data = def_fnt8x16;
-            }
+// Новый шрифт 8x16, глифами которого заменяются паттерны
+static const uint8_t *load_newfont(const options_t *opts) {
+    int size = FONT_8X16_SIZE;
+    const uint8_t *data;
 
-            if (newfont_data) {
-                if (newfont_size < FONT_8X16_SIZE) {
-                    printf("Warning: New font file size (%d) is smaller than expected (%d)\n",
-                           newfont_size, FONT_8X16_SIZE);
-                }
+    if (!opts->default_fnt) {
+        data = fontcache_get(opts->font_8x16, &size);
+    } else {
+        data = default_table(opts, VGAROM_FONT_8X16);
+    }
+    if (data && size < FONT_8X16_SIZE) {
+        fprintf(stderr, "Error: New font file size (%d) is smaller than expected (%d)\n",
+                size, FONT_8X16_SIZE);
+        return NULL;
+    }
+    return data;
+}
 
-                // Указатель на область шрифта в working_data
-                uint8_t *fontrom_ptr = working_data + font_8x16_offset;
+// Шрифты для поиска паттернов загружаются до обработки образа, чтобы
+// ошибка в них не оставляла наполовину записанный выход.
+// Возвращает 0, если паттерны не нужны или оба шрифта годятся.
+static int check_pattern_fonts(const options_t *opts) {
+    int size;
+    if (!opts->dosfont_8x16 || (!opts->font_8x16 && !opts->default_fnt)) {
+        return 0;
+    }
+    return load_dosfont(opts, &size) && load_newfont(opts) ? 0 : -1;
+}
 
-                // Ищем и заменяем паттерны
-                find_and_replace_patterns(working_data, filesize,
-                                        fontrom_ptr, font_8x16_offset,
-                                        dosfont_data, newfont_data,
-                                        FONT_8X16_SIZE);
-                if (!opts.default_fnt) {
-                    free(newfont_data);
-                }
-            }
+// Шрифт font, построенный из 8x16 (--derive), если сам он не задан.
+// Возвращает table или NULL, если строить не нужно или не из чего.
+static const uint8_t *derive_table(const options_t *opts, const vgarom_t *rom, int font,
+                                   uint8_t *table) {
+    const char *path = font == VGAROM_FONT_8X8 ? opts->font_8x8 : opts->font_8x14;
+    const uint8_t *src;
+    int size = FONT_8X16_SIZE;
 
-            free(dosfont_data);
+    if (!opts->derive || rom->font_offset[font] < 0) {
+        return NULL;
+    }
+    if (!opts->default_fnt) {
+        if (path || !opts->font_8x16) {
+            return NULL;
         }
+        src = fontcache_get(opts->font_8x16, &size);
+    } else {
+        if (default_table(opts, font)) {
+            return NULL;
+        }
+        src = default_table(opts, VGAROM_FONT_8X16);
     }
+    if (!src || size < FONT_8X16_SIZE) {
+        return NULL;
+    }
+    derive_font(src, FONT_8X16_SIZE / DERIVE_GLYPHS, table,
+                vgarom_font_size(font) / DERIVE_GLYPHS);
+    return table;
+}
 
-
-    if (0 == opts.default_fnt) {
-        replace_font(working_data, opts.font_8x8,  font_8x8_offset,  FONT_8X8_SIZE,  "8x8",  NULL);
-        replace_font(working_data, opts.font_8x14, font_8x14_offset, FONT_8X14_SIZE, "8x14", NULL);
-        replace_font(working_data, opts.font_8x16, font_8x16_offset, FONT_8X16_SIZE, "8x16", NULL);
+// Замена таблиц шрифтов из файлов или встроенными шрифтами
+static void replace_fonts(const options_t *opts, vgarom_t *rom, romstats_t *st) {
+    uint8_t derived_8x8[FONT_8X8_SIZE], derived_8x14[FONT_8X14_SIZE];
+    const uint8_t *fnt_8x8 = derive_table(opts, rom, VGAROM_FONT_8X8, derived_8x8);
+    const uint8_t *fnt_8x14 = derive_table(opts, rom, VGAROM_FONT_8X14, derived_8x14);
+    const char *source = opts->default_fnt ? "the default font" : opts->font_8x16;
+
+    if (!opts->default_fnt) {
+        st->fonts_replaced += replace_font(rom, opts->font_8x8,  VGAROM_FONT_8X8,  "8x8",
+                                           fnt_8x8, fnt_8x8 ? source : NULL);
+        st->fonts_replaced += replace_font(rom, opts->font_8x14, VGAROM_FONT_8X14, "8x14",
+                                           fnt_8x14, fnt_8x14 ? source : NULL);
+        st->fonts_replaced += replace_font(rom, opts->font_8x16, VGAROM_FONT_8X16, "8x16",
+                                           NULL, NULL);
     } else {
-        printf("Using default fonts\n");
-        replace_font(working_data, NULL,  font_8x8_offset,  FONT_8X8_SIZE, "8x8",  def_fnt8x8);
-        replace_font(working_data, NULL, font_8x14_offset, FONT_8X14_SIZE, "8x14", def_fnt8x14);
-        replace_font(working_data, NULL, font_8x16_offset, FONT_8X16_SIZE, "8x16", def_fnt8x16);
+        info("Using built-in font %s\n", opts->default_fnt);
+        st->fonts_replaced += replace_font(rom, NULL, VGAROM_FONT_8X8,  "8x8",
+                                           fnt_8x8 ? fnt_8x8 : default_table(opts, VGAROM_FONT_8X8),
+                                           fnt_8x8 ? source : NULL);
+        st->fonts_replaced += replace_font(rom, NULL, VGAROM_FONT_8X14, "8x14",
+                                           fnt_8x14 ? fnt_8x14 : default_table(opts, VGAROM_FONT_8X14),
+                                           fnt_8x14 ? source : NULL);
+        st->fonts_replaced += replace_font(rom, NULL, VGAROM_FONT_8X16, "8x16",
+                                           default_table(opts, VGAROM_FONT_8X16), NULL);
+    }
+}
+
+// Правка открытого образа: поиск шрифтов, сохранение оригинальных,
+// замена паттернов DOS-шрифта и самих шрифтов, контрольная сумма
+static void update_rom(const options_t *opts, vgarom_t *rom, romstats_t *st) {
+    uint64_t rom_hash = detect_fonts(opts, rom);
+    romstats_mark(st, ROMSTATS_DETECT);
+
+    // Сохраняем оригинальные шрифты если нужно
+    if (opts->save_pattern != NULL) {
+        save_fonts(opts, rom);
+        romstats_mark(st, ROMSTATS_WRITE);
+    }
+
+    // Обработка DOS-шрифта (поиск и замена паттернов ДО замены основного шрифта)
+    if (opts->dosfont_8x16 && rom->font_offset[VGAROM_FONT_8X16] >= 0 &&
+        (opts->font_8x16 || opts->default_fnt)) {
+        int dosfont_size;
+        const uint8_t *dosfont_data = load_dosfont(opts, &dosfont_size);
+        const uint8_t *newfont_data = dosfont_data ? load_newfont(opts) : NULL;
+
+        if (newfont_data) {
+            // Ищем и заменяем паттерны
+            vgarom_pattern_stats_t stats;
+            info("\nSearching for DOS font patterns...\n");
+            replace_dos_patterns(opts, rom, rom_hash, dosfont_data, dosfont_size,
+                                 newfont_data, &stats, st);
+            info("  Characters compared: %d\n", stats.chars_compared);
+            info("  Non-matching patterns found: %d\n", stats.patterns_found);
+            info("  Patterns replaced in ROM: %d\n", stats.patterns_replaced);
+            if (opts->fuzzy > 0) {
+                info("  Fuzzy matches among them: %d\n", stats.fuzzy_hits);
+            }
+        }
     }
+    romstats_mark(st, ROMSTATS_PATTERNS);
+
+    replace_fonts(opts, rom, st);
+    romstats_mark(st, ROMSTATS_FONTS);
 
     #ifdef __DEBUG__
-    save_tmp_debfile("fnt_updated.dat", filesize, working_data);
+    save_tmp_debfile("fnt_updated.dat", rom->size, rom->data);
     #endif
 
     // Обновляем контрольную сумму
-    update_checksum(working_data, filesize);
+    uint8_t checksum = vgarom_update_checksum(rom);
+    romstats_mark(st, ROMSTATS_CHECKSUM);
+    info("Updated checksum to: 0x%02X\n", checksum);
+}
 
-    // Подготавливаем выходные данные
-    if (opts.output_normal) {
-        output_data = working_data;
-    } else {
-        linear_to_odd_even(working_data, rom_data, filesize);
-        output_data = rom_data;
+// Хеш шрифта для ключа кэша результатов, 0 - шрифт не задан
+static int font_hash(const char *path, uint64_t *hash) {
+    int size;
+    *hash = 0;
+    if (!path) {
+        return 0;
+    }
+    // Ошибку чтения шрифта выведет обычная обработка
+    if (path[0] != '@' && access(path, R_OK) != 0) {
+        return -1;
     }
+    const uint8_t *data = fontcache_get(path, &size);
+    if (!data) {
+        return -1;
+    }
+    *hash = fontcache_hash(data, size);
+    return 0;
+}
 
-    // Записываем результат
-    write_rom_file(opts.output_rom, output_data, filesize);
+// Ключ кэша результатов - хеш записи из 8 слов:
+//   [0] RESULT_CACHE_VERSION;
+//   [1] хеш входного образа;
+//   [2] флаги: бит 0 - -n, бит 1 - -m, бит 2 - -d, биты 3-7 - --fuzzy,
+//       бит 8 - --derive;
+//   [3..5] хеши таблиц 8x8, 8x14 и 8x16 (из -d или -8/-4/-6), 0 - нет;
+//   [6] хеш DOS-шрифта -f, 0 - нет;
+//   [7] размер образа.
+// При любом изменении этой записи (новое поле, другие биты флагов)
+// RESULT_CACHE_VERSION нужно увеличить, иначе старые записи кэша
+// совпадут с новыми ключами. Возвращает -1, если шрифт не читается, -
+// тогда образ обрабатывается как обычно и ошибка выводится там.
+static int result_key(const options_t *opts, const uint8_t *image, int size, uint64_t *key) {
+    uint64_t rec[8] = {
+        RESULT_CACHE_VERSION,
+        fontcache_hash(image, size),
+        opts->is_normal | opts->output_normal << 1 | (opts->default_fnt != NULL) << 2 |
+            opts->fuzzy << 3 | (uint64_t)opts->derive << 8,
+    };
+
+    if (opts->default_fnt) {
+        for (int font = 0; font < VGAROM_FONT_COUNT; font++) {
+            const uint8_t *data = default_table(opts, font);
+            rec[3 + font] = data ? fontcache_hash(data, vgarom_font_size(font)) : 0;
+        }
+    } else if (font_hash(opts->font_8x8, &rec[3]) != 0 ||
+               font_hash(opts->font_8x14, &rec[4]) != 0 ||
+               font_hash(opts->font_8x16, &rec[5]) != 0) {
+        return -1;
+    }
+    if (font_hash(opts->dosfont_8x16, &rec[6]) != 0) {
+        return -1;
+    }
+    rec[7] = size;
 
-    printf("\nROM updated successfully. Output written to %s\n", opts.output_rom);
+    *key = fontcache_hash((const uint8_t *)rec, sizeof(rec));
+    return 0;
+}
 
-    if (NULL != rom_data) {
-        free(rom_data);
+// Записывает буфер в файл. Старый файл удаляется, а не переписывается:
+// он может быть жёсткой ссылкой на другой файл.
+static int write_file(const char *path, const uint8_t *data, int size) {
+    if (unlink(path) != 0 && errno != ENOENT) {
+        perror("Error replacing output file");
+        return -1;
+    }
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) {
+        perror("Error opening output file");
+        return -1;
     }
-    if (output_data != NULL && output_data != working_data) {
-        free(output_data);
+    if (write(fd, data, size) != size) {
+        perror("Error writing output file");
+        close(fd);
+        return -1;
     }
-    if (working_data != NULL && working_data != rom_data) {
-        free(working_data);
+    if (close(fd) != 0) {
+        perror("Error writing output file");
+        return -1;
     }
     return 0;
 }
+
+// Читает файл целиком в выделенный буфер
+static uint8_t *read_file(const char *path, int *size) {
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd == -1 || fstat(fd, &st) != 0) {
+        fprintf(stderr, "Error opening %s: %s\n", path, strerror(errno));
+        if (fd != -1) {
+            close(fd);
+        }
+        return NULL;
+    }
+    uint8_t *data = malloc(st.st_size > 0 ? st.st_size : 1);
+    if (!data) {
+        perror("Memory allocation failed");
+        close(fd);
+        return NULL;
+    }
+    if (read(fd, data, st.st_size) != st.st_size) {
+        fprintf(stderr, "Error reading %s\n", path);
+        free(data);
+        close(fd);
+        return NULL;
+    }
+    close(fd);
+    *size = st.st_size;
+    return data;
+}
+
+// Записывает вместо образа патч от исходного образа к результату.
+// Патч строится в порядке байт входа по областям, изменённым при
+// обработке, и применяется к тому же файлу, что подавался на вход.
+static int write_patch(const options_t *opts, const vgarom_t *rom,
+                       const uint8_t *original, romstats_t *st) {
+    vgarom_range_t *ranges;
+    uint8_t *patch;
+    int patch_size;
+
+    int nranges = vgarom_changes(rom, rom->flags, &ranges);
+    uint8_t *patched = malloc(rom->size);
+    if (nranges < 0 || !patched) {
+        perror("Memory allocation failed");
+        free(ranges);
+        free(patched);
+        return -1;
+    }
+    st->allocations += 2;
+
+    vgarom_serialize(rom, original, patched, rom->size, rom->flags);
+    int err = rompatch_build(opts->patch, original, patched, rom->size,
+                             ranges, nranges, &patch, &patch_size);
+    free(patched);
+    free(ranges);
+    if (err != ROMPATCH_OK) {
+        fprintf(stderr, "Error: %s\n", rompatch_strerror(err));
+        return -1;
+    }
+    st->allocations++;
+
+    int rc = write_file(opts->output_rom, patch, patch_size);
+    if (rc == 0) {
+        info("\nPatch (%d bytes, %d changed regions) written to %s\n",
+             patch_size, nranges, opts->output_rom);
+    }
+    free(patch);
+    return rc;
+}
+
+// Применение патча IPS/BPS к входному файлу как есть, без разбора
+// образа: патчи fontupdate строятся в порядке байт входа, так что
+// чётно-нечётный образ патчится без перестановки. Время применения
+// относится к фазе записи.
+static int apply_file(const options_t *opts, romstats_t *st) {
+    rom_io_t io;
+    struct stat in_st;
+    uint8_t *out;
+    int patch_size, out_size;
+
+    if (rom_io_open_input(&io, opts->input_rom, &in_st) != 0) {
+        return -1;
+    }
+    st->size = io.size;
+    st->allocations += io.mappings;
+    uint8_t *patch = read_file(opts->apply, &patch_size);
+    if (!patch) {
+        rom_io_close(&io);
+        return -1;
+    }
+    st->allocations++;
+    romstats_mark(st, ROMSTATS_LOAD);
+
+    int err = rompatch_apply(patch, patch_size, io.in, io.size, &out, &out_size);
+    free(patch);
+    rom_io_close(&io);
+    if (err != ROMPATCH_OK) {
+        fprintf(stderr, "Error: %s: %s\n", opts->apply, rompatch_strerror(err));
+        return -1;
+    }
+    st->allocations++;
+
+    int rc = write_file(opts->output_rom, out, out_size);
+    free(out);
+    romstats_mark(st, ROMSTATS_WRITE);
+    if (rc == 0) {
+        info("\nPatch %s applied. Output written to %s\n", opts->apply, opts->output_rom);
+        st->status = "ok";
+    }
+    return rc;
+}
+
+// Проверяет размер и заголовок 55 AA входного образа
+static int check_input(const options_t *opts, const rom_io_t *io) {
+    switch (vgarom_check_image(io->in, io->size, opts->is_normal ? VGAROM_LINEAR : 0)) {
+        case VGAROM_OK:
+            return 0;
+        case VGAROM_ERR_SIZE:
+            printf("\nWarning! The image %s is too small for odd/even layout\n", opts->input_rom);
+            return -1;
+        default:
+            printf("\nWarning! The image %s is not a BIOS ROM\n", opts->input_rom);
+            printf("Check the correctness of the selection of alternation of even and odd data in ROM.\n");
+            return -1;
+    }
+}
+
+// Список кандидатов в таблицы шрифтов (--detect) без изменения образа
+static int detect_tables(const options_t *opts) {
+    rom_io_t io;
+    struct stat in_st;
+    vgarom_t rom;
+    font_candidate_t cands[FONT_MAX_CANDIDATES];
+
+    if (rom_io_open_input(&io, opts->input_rom, &in_st) != 0) {
+        return -1;
+    }
+    if (check_input(opts, &io) != 0) {
+        rom_io_close(&io);
+        return -1;
+    }
+    int err = vgarom_open_mem(&rom, io.in, io.size, opts->is_normal ? VGAROM_LINEAR : 0, NULL);
+    rom_io_close(&io);
+    if (err != VGAROM_OK) {
+        fprintf(stderr, "Error: %s\n", vgarom_strerror(err));
+        return -1;
+    }
+
+    vgarom_locate_fonts(&rom);
+    font_pointers_t ptrs;
+    if (find_font_pointers(rom.data, rom.size, &ptrs) == 0) {
+        printf("INT 10h/1130h font pointers in %s (handler at 0x%X):\n",
+               opts->input_rom, ptrs.handler);
+        printf("  %-6s 0x%X\n  %-6s 0x%X\n  %-6s 0x%X\n", "8x8", ptrs.offset_8x8,
+               "8x14", ptrs.offset_8x14, "8x16", ptrs.offset_8x16);
+        const int alt[VGAROM_ALT_COUNT] = { ptrs.offset_9x14, ptrs.offset_9x16 };
+        for (int i = 0; i < VGAROM_ALT_COUNT; i++) {
+            if (alt[i] >= 0) {
+                printf("  %-6s 0x%X (fix-up)\n", alt_names[i], alt[i]);
+            } else {
+                printf("  %-6s none\n", alt_names[i]);
+            }
+        }
+    } else {
+        printf("INT 10h/1130h font pointers in %s: not found\n", opts->input_rom);
+    }
+    int ncands = vgarom_rank_fonts(&rom, cands, FONT_MAX_CANDIDATES);
+    printf("Font table candidates in %s (confidence %d%% and above is used):\n",
+           opts->input_rom, FONT_ACCEPT_SCORE);
+    printf("  %-3s %-6s %-8s %-11s %s\n", "#", "table", "offset", "confidence", "used");
+    for (int i = 0; i < ncands; i++) {
+        int font = cands[i].font;
+        int used = rom.font_offset[font] == cands[i].offset;
+        printf("  %-3d %-6s 0x%-6X %-11d %s\n", i + 1, font_names[font], cands[i].offset,
+               cands[i].score, used ? "yes" : "no");
+    }
+    if (ncands == 0) {
+        printf("  none\n");
+    }
+    vgarom_close(&rom);
+    return 0;
+}
+
+// Обработка одного ROM с заполнением статистики
+static int process_file(const options_t *o, romstats_t *st) {
+    options_t opts = *o;
+
+    rom_io_t io;
+    struct stat in_st;
+    vgarom_t rom;
+    uint8_t *working_data = NULL;
+    unsigned flags = opts.is_normal ? VGAROM_LINEAR : 0;
+
+    if (rom_io_open_input(&io, opts.input_rom, &in_st) != 0) {
+        return -1;
+    }
+    int filesize = io.size;
+    st->size = filesize;
+    st->allocations += io.mappings;
+
+    // Проверяем заголовок 55 AA и шрифты до создания выходного файла
+    if (check_input(&opts, &io) != 0 || check_pattern_fonts(&opts) != 0) {
+        rom_io_close(&io);
+        return -1;
+    }
+
+    // Такой же образ с теми же шрифтами уже обработан - берём результат
+    // из кэша. Сохранение шрифтов (-s) требует полной обработки, а патчи
+    // в кэше не хранятся.
+    uint64_t key = 0;
+    int use_cache = opts.cache_dir && !opts.save_pattern && !opts.patch &&
+                    rescache_init(opts.cache_dir) == 0 &&
+                    result_key(&opts, io.in, filesize, &key) == 0;
+    romstats_mark(st, ROMSTATS_LOAD);
+    if (use_cache && rescache_fetch(opts.cache_dir, key, opts.output_rom) == 0) {
+        info("Result found in cache %s\n", opts.cache_dir);
+        info("\nROM updated successfully. Output written to %s\n", opts.output_rom);
+        rom_io_close(&io);
+        romstats_mark(st, ROMSTATS_WRITE);
+        st->status = "cached";
+        return 0;
+    }
+
+    if (!opts.patch) {
+        int mappings = io.mappings;
+        if (rom_io_open_output(&io, opts.output_rom, &in_st) != 0) {
+            rom_io_close(&io);
+            return -1;
+        }
+        st->allocations += io.mappings - mappings;
+        romstats_mark(st, ROMSTATS_WRITE);
+    }
+
+    // Рабочий (линейный) образ строится прямо в выходном файле.
+    // Только линейный вход с перемешанным выходом правится на месте
+    // в копии входа, чтобы затем перемешать его в выходной файл.
+    // Для патча нужен неизменённый вход, и образ правится в буфере
+    // библиотеки.
+    if (opts.is_normal) {
+        info("Using normal (linear) font layout\n");
+    }
+    if (opts.patch) {
+        working_data = NULL;
+        st->allocations++;
+    } else if (opts.is_normal) {
+        working_data = opts.output_normal ? io.out : io.in;
+    } else {
+        working_data = io.out;
+    }
+    int err = vgarom_open_mem(&rom, io.in, filesize, flags, working_data);
+    if (err != VGAROM_OK) {
+        fprintf(stderr, "Error: %s\n", vgarom_strerror(err));
+        rom_io_close(&io);
+        return -1;
+    }
+    if (opts.patch) {
+        vgarom_track_changes(&rom);
+    }
+    romstats_mark(st, ROMSTATS_DEINTERLEAVE);
+    st->bytes_scanned += filesize;
+    if (!opts.is_normal) {
+        info("Converting from odd/even to linear layout\n");
+    }
+    info("Original checksum: 0x%02X (%s)\n", rom.analysis.checksum_byte,
+         (uint8_t)(rom.analysis.sum + rom.analysis.checksum_byte) == 0 ? "valid" : "invalid");
+
+    #ifdef __DEBUG__
+    save_tmp_debfile("normalize.dat", filesize, rom.data);
+    #endif
+
+    update_rom(&opts, &rom, st);
+
+    if (opts.patch) {
+        int rc = write_patch(&opts, &rom, io.in, st);
+        vgarom_close(&rom);
+        rom_io_close(&io);
+        romstats_mark(st, ROMSTATS_WRITE);
+        if (rc == 0) {
+            st->status = "ok";
+        }
+        return rc;
+    }
+
+    // Подготавливаем выходные данные
+    if (!opts.output_normal) {
+        if (working_data == io.out) {
+            // Перемешиваем через копию входа, она больше не нужна
+            vgarom_serialize(&rom, io.in, io.in, filesize, 0);
+            memcpy(io.out, io.in, filesize);
+        } else {
+            vgarom_serialize(&rom, io.in, io.out, filesize, 0);
+        }
+    }
+
+    info("\nROM updated successfully. Output written to %s\n", opts.output_rom);
+
+    vgarom_close(&rom);
+    rom_io_close(&io);
+    if (use_cache && rescache_store(opts.cache_dir, key, opts.output_rom) != 0) {
+        printf("Warning: Unable to store the result in cache %s\n", opts.cache_dir);
+    }
+    romstats_mark(st, ROMSTATS_WRITE);
+    st->status = "ok";
+    return 0;
+}
+
+// Обработка одного ROM. Возвращает 0 или -1 при ошибке.
+static int process_rom(const options_t *opts) {
+    romstats_t st;
+
+    romstats_begin(&st, opts->input_rom, opts->output_rom);
+    int rc = opts->apply ? apply_file(opts, &st) : process_file(opts, &st);
+    romstats_write(&st);
+    return rc;
+}
+
+// Разбивает строку на аргументы и разбирает их поверх опций командной
+// строки. Строка должна жить, пока используются полученные опции.
+static int parse_job_args(char *line, const options_t *defaults, options_t *opts) {
+    char *argv[MAX_MANIFEST_ARGS + 1];
+    int argc = 0;
+
+    argv[argc++] = "fontupdate";
+    for (char *tok = strtok(line, " \t\r\n"); tok; tok = strtok(NULL, " \t\r\n")) {
+        if (argc == MAX_MANIFEST_ARGS) {
+            fprintf(stderr, "Error: Too many arguments\n");
+            return -1;
+        }
+        argv[argc++] = tok;
+    }
+    argv[argc] = NULL;
+
+    *opts = *defaults;
+    opts->input_rom = NULL;
+    opts->output_rom = NULL;
+    opts->batch = NULL;
+    opts->serve = NULL;
+    opts->variants = NULL;
+    if (parse_args(argc, argv, opts) != 0 || opts->batch != NULL || opts->serve != NULL ||
+        opts->variants != NULL) {
+        return -1;
+    }
+    // Индекс разметки, файл статистики и библиотека шрифтов одни на
+    // запуск - из командной строки
+    opts->index = defaults->index;
+    opts->stats = defaults->stats;
+    opts->fontlib = defaults->fontlib;
+    return 0;
+}
+
+// Строка манифеста: те же параметры, обязательны -i и -o
+static int parse_manifest_line(char *line, const options_t *defaults, options_t *opts) {
+    if (parse_job_args(line, defaults, opts) != 0) {
+        return -1;
+    }
+    if (!opts->input_rom || !opts->output_rom) {
+        fprintf(stderr, "Error: Both -i and -o are required in a manifest line\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Добавляет задание в массив, увеличивая его при необходимости
+static batch_job_t *batch_add_job(batch_job_t **jobs, int *njobs, int *cap) {
+    if (*njobs == *cap) {
+        int new_cap = *cap ? *cap * 2 : 64;
+        batch_job_t *p = realloc(*jobs, new_cap * sizeof(**jobs));
+        if (!p) {
+            perror("Memory allocation failed");
+            return NULL;
+        }
+        *jobs = p;
+        *cap = new_cap;
+    }
+    batch_job_t *job = &(*jobs)[(*njobs)++];
+    memset(job, 0, sizeof(*job));
+    return job;
+}
+
+typedef int (*parse_line_fn)(char *line, const options_t *defaults, options_t *opts);
+
+// Читает файл заданий, строки разбирает parse_line. Возвращает число
+// пропущенных строк или -1.
+static int load_manifest(const char *path, const options_t *defaults,
+                         parse_line_fn parse_line, batch_job_t **jobs, int *njobs) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "Error opening %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    char line[4096];
+    int cap = 0, lineno = 0, errors = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        char *p = line + strspn(line, " \t\r\n");
+        if (*p == '\0' || *p == '#') {
+            continue;
+        }
+        char *args = strdup(p);
+        options_t opts;
+        if (!args || parse_line(args, defaults, &opts) != 0) {
+            fprintf(stderr, "%s:%d: invalid job, skipped\n", path, lineno);
+            free(args);
+            errors++;
+            continue;
+        }
+        batch_job_t *job = batch_add_job(jobs, njobs, &cap);
+        if (!job) {
+            free(args);
+            fclose(f);
+            return -1;
+        }
+        job->opts = opts;
+        job->args = args;
+    }
+    fclose(f);
+    return errors;
+}
+
+static int load_directory(const char *path, const options_t *defaults,
+                          batch_job_t **jobs, int *njobs) {
+    const char *out_dir = defaults->output_rom ? defaults->output_rom : DEFAULT_BATCH_DIR;
+    if (mkdir(out_dir, 0755) != 0 && errno != EEXIST) {
+        perror("Error creating output directory");
+        return -1;
+    }
+
+    DIR *dir = opendir(path);
+    if (!dir) {
+        perror("Error opening batch directory");
+        return -1;
+    }
+
+    struct dirent *de;
+    int cap = 0;
+    while ((de = readdir(dir)) != NULL) {
+        if (de->d_name[0] == '.') {
+            continue;
+        }
+        char *in = malloc(strlen(path) + strlen(de->d_name) + 2);
+        char *out = malloc(strlen(out_dir) + strlen(de->d_name) + 2);
+        if (!in || !out) {
+            perror("Memory allocation failed");
+            free(in);
+            free(out);
+            closedir(dir);
+            return -1;
+        }
+        sprintf(in, "%s/%s", path, de->d_name);
+        sprintf(out, "%s/%s", out_dir, de->d_name);
+
+        struct stat st;
+        if (stat(in, &st) != 0 || !S_ISREG(st.st_mode)) {
+            free(in);
+            free(out);
+            continue;
+        }
+
+        batch_job_t *job = batch_add_job(jobs, njobs, &cap);
+        if (!job) {
+            free(in);
+            free(out);
+            closedir(dir);
+            return -1;
+        }
+        job->opts = *defaults;
+        job->opts.input_rom = job->input_path = in;
+        job->opts.output_rom = job->output_path = out;
+    }
+    closedir(dir);
+    return 0;
+}
+
+static void batch_worker(int idx, void *ctx) {
+    batch_job_t *job = &((batch_job_t *)ctx)[idx];
+
+    job->status = process_rom(&job->opts);
+    if (job->status == 0) {
+        printf("[OK]   %s -> %s\n", job->opts.input_rom, job->opts.output_rom);
+    } else {
+        printf("[FAIL] %s\n", job->opts.input_rom);
+    }
+}
+
+static void print_fontcache_stats(void) {
+    fontcache_stats_t st;
+    fontcache_stats(&st);
+    printf("Font cache: %d hits (%d by content), %d misses, %d fonts, %ld bytes\n",
+           st.path_hits + st.hash_hits, st.hash_hits, st.misses, st.fonts, st.bytes);
+}
+
+static void print_layoutidx_stats(const options_t *opts) {
+    layoutidx_stats_t st;
+
+    if (opts->index) {
+        layoutidx_stats(&st);
+        printf("Layout index: %d hits, %d misses, %d records updated\n",
+               st.hits, st.misses, st.updated);
+    }
+}
+
+// Вытесняет старые записи кэша результатов и выводит его статистику
+static void finish_rescache(const options_t *opts, int report) {
+    rescache_stats_t st;
+
+    if (!opts->cache_dir) {
+        return;
+    }
+    rescache_evict(opts->cache_dir, opts->cache_max_mb * 1024 * 1024);
+    rescache_stats(&st);
+    if (report) {
+        printf("Result cache: %d hits, %d misses, %d stored, %d evicted; %d entries, %ld bytes\n",
+               st.hits, st.misses, st.stored, st.evicted, st.entries, st.bytes);
+    }
+}
+
+static int run_batch(const options_t *defaults) {
+    batch_job_t *jobs = NULL;
+    int njobs = 0;
+    int rc;
+    struct stat st;
+
+    if (stat(defaults->batch, &st) != 0) {
+        perror("Error accessing batch path");
+        return -1;
+    }
+    if (S_ISDIR(st.st_mode)) {
+        rc = load_directory(defaults->batch, defaults, &jobs, &njobs);
+    } else {
+        rc = load_manifest(defaults->batch, defaults, parse_manifest_line, &jobs, &njobs);
+    }
+
+    int nthreads = defaults->jobs > 0 ? defaults->jobs : workpool_default_threads();
+    int skipped = rc > 0 ? rc : 0;
+    int failed = 0;
+    if (rc >= 0) {
+        struct timespec t0, t1;
+        if (nthreads > njobs) {
+            nthreads = njobs;
+        }
+        printf("Batch: %d jobs on %d threads\n", njobs, nthreads);
+
+        quiet = 1;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        if (workpool_run(njobs, nthreads, batch_worker, jobs) != 0) {
+            rc = -1;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        quiet = 0;
+
+        for (int i = 0; i < njobs; i++) {
+            if (jobs[i].status != 0) {
+                failed++;
+            }
+        }
+        printf("\nBatch finished: %d succeeded, %d failed, %d skipped, %.3f s\n",
+               njobs - failed, failed, skipped,
+               (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9);
+        print_fontcache_stats();
+        print_layoutidx_stats(defaults);
+        finish_rescache(defaults, 1);
+    }
+
+    for (int i = 0; i < njobs; i++) {
+        free(jobs[i].args);
+        free(jobs[i].input_path);
+        free(jobs[i].output_path);
+    }
+    free(jobs);
+    return (rc != 0 || failed) ? -1 : 0;
+}
+
+// Строка списка вариантов: набор шрифтов и -o. Вход, DOS-шрифт,
+// порядок байт входа и сохранение шрифтов общие для всех вариантов.
+static int parse_variant_line(char *line, const options_t *defaults, options_t *opts) {
+    if (parse_job_args(line, defaults, opts) != 0) {
+        return -1;
+    }
+    if (!opts->output_rom || opts->input_rom || opts->save_pattern != defaults->save_pattern ||
+        opts->dosfont_8x16 != defaults->dosfont_8x16 || opts->is_normal != defaults->is_normal ||
+        opts->fuzzy != defaults->fuzzy || opts->patch || opts->apply) {
+        fprintf(stderr, "Error: A variant line needs -o and takes only font and output options\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Образ, разобранный один раз для всех вариантов
+typedef struct {
+    const vgarom_t *base;
+    const uint8_t *image;           // входной образ как есть
+    const vgarom_dos_hit_t *hits;   // вхождения глифов DOS-шрифта
+    int nhits;                      // -1 - паттерны не заменяются
+    batch_job_t *jobs;
+} variants_t;
+
+// Вариант - копия разобранного образа, в которую пишутся глифы
+// и контрольная сумма; поиск таблиц и паттернов не повторяется
+static int build_variant(const variants_t *v, const options_t *opts, romstats_t *st) {
+    vgarom_t rom;
+    uint8_t *out = NULL;
+
+    if (vgarom_copy(&rom, v->base, NULL) != VGAROM_OK ||
+        (!opts->output_normal && !(out = malloc(rom.size)))) {
+        perror("Memory allocation failed");
+        vgarom_close(&rom);
+        return -1;
+    }
+    st->allocations += out ? 2 : 1;
+    romstats_mark(st, ROMSTATS_DEINTERLEAVE);
+
+    if (v->nhits >= 0 && (opts->font_8x16 || opts->default_fnt)) {
+        const uint8_t *newfont = load_newfont(opts);
+        if (!newfont) {
+            vgarom_close(&rom);
+            free(out);
+            return -1;
+        }
+        vgarom_apply_dos_patterns(&rom, v->hits, v->nhits, newfont);
+        st->pattern_replacements += v->nhits;
+    }
+    romstats_mark(st, ROMSTATS_PATTERNS);
+
+    replace_fonts(opts, &rom, st);
+    romstats_mark(st, ROMSTATS_FONTS);
+    vgarom_update_checksum(&rom);
+    romstats_mark(st, ROMSTATS_CHECKSUM);
+
+    if (out) {
+        vgarom_serialize(&rom, v->image, out, rom.size, 0);
+    }
+    int rc = write_file(opts->output_rom, out ? out : rom.data, rom.size);
+    vgarom_close(&rom);
+    free(out);
+    romstats_mark(st, ROMSTATS_WRITE);
+    if (rc == 0) {
+        st->status = "ok";
+    }
+    return rc;
+}
+
+static void variant_worker(int idx, void *ctx) {
+    const variants_t *v = ctx;
+    batch_job_t *job = &v->jobs[idx];
+    romstats_t st;
+
+    romstats_begin(&st, job->opts.input_rom, job->opts.output_rom);
+    st.size = v->base->size;
+    job->status = build_variant(v, &job->opts, &st);
+    romstats_write(&st);
+    if (job->status == 0) {
+        printf("[OK]   %s\n", job->opts.output_rom);
+    } else {
+        printf("[FAIL] %s\n", job->opts.output_rom);
+    }
+}
+
+// Один образ с несколькими наборами шрифтов: образ читается и
+// разбирается, а вхождения паттернов DOS-шрифта ищутся один раз
+static int run_variants(const options_t *defaults) {
+    batch_job_t *jobs = NULL;
+    int njobs = 0;
+    rom_io_t io;
+    struct stat in_st;
+    vgarom_t base;
+    vgarom_dos_hit_t *hits = NULL;
+    int nhits = -1;
+    romstats_t st;
+
+    // Новые шрифты вариантов проверяет build_variant
+    int dosfont_size;
+    if (defaults->dosfont_8x16 && !load_dosfont(defaults, &dosfont_size)) {
+        return -1;
+    }
+
+    int skipped = load_manifest(defaults->variants, defaults, parse_variant_line, &jobs, &njobs);
+    if (skipped < 0) {
+        free(jobs);
+        return -1;
+    }
+
+    romstats_begin(&st, defaults->input_rom, NULL);
+    int rc = rom_io_open_input(&io, defaults->input_rom, &in_st);
+    if (rc == 0 && (rc = check_input(defaults, &io)) == 0) {
+        st.size = io.size;
+        st.allocations += io.mappings;
+        romstats_mark(&st, ROMSTATS_LOAD);
+        int err = vgarom_open_mem(&base, io.in, io.size, defaults->is_normal ? VGAROM_LINEAR : 0, NULL);
+        if (err != VGAROM_OK) {
+            fprintf(stderr, "Error: %s\n", vgarom_strerror(err));
+            rc = -1;
+        }
+    }
+    // Вход остаётся отображённым: из него берутся байты, которые
+    // перемешивание образа больше 32 КБ не покрывает
+    if (rc != 0) {
+        if (io.in) {
+            rom_io_close(&io);
+        }
+        romstats_write(&st);
+        free(jobs);
+        return -1;
+    }
+    st.allocations++;
+    st.bytes_scanned += base.size;
+    romstats_mark(&st, ROMSTATS_DEINTERLEAVE);
+
+    uint64_t rom_hash = detect_fonts(defaults, &base);
+    romstats_mark(&st, ROMSTATS_DETECT);
+    if (defaults->save_pattern != NULL) {
+        save_fonts(defaults, &base);
+        romstats_mark(&st, ROMSTATS_WRITE);
+    }
+
+    // Вхождения паттернов зависят только от образа и DOS-шрифта
+    if (defaults->dosfont_8x16 && base.font_offset[VGAROM_FONT_8X16] >= 0) {
+        const uint8_t *dosfont_data = load_dosfont(defaults, &dosfont_size);
+        hits = malloc(VGAROM_MAX_DOS_HITS(base.size) * sizeof(*hits));
+        if (dosfont_data && hits) {
+            vgarom_pattern_stats_t stats;
+            st.allocations++;
+            info("\nSearching for DOS font patterns...\n");
+            nhits = find_dos_hits(defaults, &base, rom_hash, dosfont_data, dosfont_size,
+                                  hits, &stats, &st);
+            info("  Non-matching patterns found: %d\n", stats.patterns_found);
+            info("  Occurrences in ROM: %d\n", nhits);
+            if (defaults->fuzzy > 0) {
+                info("  Fuzzy matches among them: %d\n", stats.fuzzy_hits);
+            }
+        }
+    }
+    romstats_mark(&st, ROMSTATS_PATTERNS);
+    st.status = "ok";
+    romstats_write(&st);
+
+    int nthreads = defaults->jobs > 0 ? defaults->jobs : workpool_default_threads();
+    if (nthreads > njobs) {
+        nthreads = njobs;
+    }
+    printf("\nVariants: %d font sets on %d threads\n", njobs, nthreads);
+
+    variants_t v = { .base = &base, .image = io.in, .hits = hits, .nhits = nhits, .jobs = jobs };
+    struct timespec t0, t1;
+    int failed = 0;
+    quiet = 1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (workpool_run(njobs, nthreads, variant_worker, &v) != 0) {
+        rc = -1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    quiet = 0;
+
+    for (int i = 0; i < njobs; i++) {
+        if (jobs[i].status != 0) {
+            failed++;
+        }
+    }
+    printf("\nVariants finished: %d succeeded, %d failed, %d skipped, %.3f s\n",
+           njobs - failed, failed, skipped,
+           (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9);
+    print_fontcache_stats();
+    print_layoutidx_stats(defaults);
+
+    vgarom_close(&base);
+    rom_io_close(&io);
+    free(hits);
+    for (int i = 0; i < njobs; i++) {
+        free(jobs[i].args);
+    }
+    free(jobs);
+    return (rc != 0 || failed || skipped) ? -1 : 0;
+}
+
+// Буферы сервера, общие для всех запросов
+typedef struct {
+    const options_t *defaults;
+    uint8_t *work;         // рабочий образ перемешанного входа
+    uint8_t *out;          // перемешанный результат
+    int served;
+    int failed;
+} server_t;
+
+// Загружает шрифты запроса в кэш заранее, чтобы вернуть клиенту
+// ошибку загрузки
+static int preload_fonts(const options_t *opts, char *error, int error_size) {
+    const char *paths[] = { opts->font_8x8, opts->font_8x14, opts->font_8x16, opts->dosfont_8x16 };
+
+    for (size_t i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+        int size;
+        if (paths[i] && !fontcache_get(paths[i], &size)) {
+            snprintf(error, error_size, "Cannot load font %s", paths[i]);
+            return -1;
+        }
+    }
+    if (check_pattern_fonts(opts) != 0) {
+        snprintf(error, error_size, "Fonts for pattern matching must have %d bytes",
+                 FONT_8X16_SIZE);
+        return -1;
+    }
+    return 0;
+}
+
+// Обработка одного запроса сервера с заполнением статистики
+static int serve_one(server_t *srv, serve_request_t *req, romstats_t *st) {
+    options_t opts;
+    vgarom_t rom;
+
+    st->size = req->size;
+    if (parse_job_args(req->args, srv->defaults, &opts) != 0 ||
+        opts.input_rom || opts.output_rom || opts.save_pattern || opts.patch || opts.apply) {
+        snprintf(req->error, sizeof(req->error), "Invalid options");
+        return -1;
+    }
+    if (preload_fonts(&opts, req->error, sizeof(req->error)) != 0) {
+        return -1;
+    }
+    romstats_mark(st, ROMSTATS_LOAD);
+
+    // Линейный образ правится прямо в буфере запроса
+    unsigned flags = opts.is_normal ? VGAROM_LINEAR : 0;
+    uint8_t *work = opts.is_normal ? req->rom : srv->work;
+    int err = vgarom_open_mem(&rom, req->rom, req->size, flags, work);
+    if (err != VGAROM_OK) {
+        snprintf(req->error, sizeof(req->error), "%s", vgarom_strerror(err));
+        return -1;
+    }
+    romstats_mark(st, ROMSTATS_DEINTERLEAVE);
+    st->bytes_scanned += req->size;
+
+    update_rom(&opts, &rom, st);
+
+    if (opts.output_normal) {
+        req->result = rom.data;
+    } else {
+        vgarom_serialize(&rom, req->rom, srv->out, rom.size, 0);
+        req->result = srv->out;
+    }
+    vgarom_close(&rom);
+    romstats_mark(st, ROMSTATS_WRITE);
+    st->status = "ok";
+    return 0;
+}
+
+static int serve_rom(serve_request_t *req, void *ctx) {
+    server_t *srv = ctx;
+    romstats_t st;
+
+    romstats_begin(&st, NULL, NULL);
+    int rc = serve_one(srv, req, &st);
+    romstats_write(&st);
+    // Прежнее содержимое шрифтов, изменённых между запросами
+    fontcache_collect();
+    if (rc == 0) {
+        srv->served++;
+    } else {
+        srv->failed++;
+    }
+    return rc;
+}
+
+static int run_server(const options_t *defaults) {
+    server_t srv = { .defaults = defaults };
+    char error[256];
+
+    srv.work = malloc(SERVE_MAX_ROM);
+    srv.out = malloc(SERVE_MAX_ROM);
+    if (!srv.work || !srv.out) {
+        perror("Memory allocation failed");
+        free(srv.work);
+        free(srv.out);
+        return -1;
+    }
+
+    // Шрифты из командной строки загружаются до первого запроса
+    int rc = preload_fonts(defaults, error, sizeof(error));
+    if (rc != 0) {
+        fprintf(stderr, "Error: %s\n", error);
+    } else {
+        printf("Serving on %s\n", defaults->serve);
+        fflush(stdout);
+        quiet = 1;
+        rc = serve_run(defaults->serve, serve_rom, &srv);
+        quiet = 0;
+        printf("\nServer stopped: %d ROMs processed, %d failed\n", srv.served, srv.failed);
+        print_fontcache_stats();
+        print_layoutidx_stats(defaults);
+    }
+
+    fontcache_clear();
+    free(srv.work);
+    free(srv.out);
+    return rc;
+}
+
+int main(int argc, char *argv[]) {
+    options_t opts = parse_options(argc, argv);
+
+    int rc;
+
+    if (opts.index && layoutidx_load(opts.index) != 0) {
+        return 1;
+    }
+    if (opts.stats && romstats_open(opts.stats) != 0) {
+        return 1;
+    }
+    if (opts.fontlib && fontcache_open_library(opts.fontlib) != 0) {
+        return 1;
+    }
+
+    if (opts.detect) {
+        rc = detect_tables(&opts);
+    } else if (opts.serve) {
+        rc = run_server(&opts);
+    } else if (opts.batch) {
+        rc = run_batch(&opts);
+    } else if (opts.variants) {
+        rc = run_variants(&opts);
+    } else {
+        if (!opts.output_rom) {
+            opts.output_rom = DEFAULT_OUTPUT;
+        }
+        rc = process_rom(&opts);
+        finish_rescache(&opts, 0);
+    }
+
+    if (opts.index) {
+        layoutidx_save(opts.index);
+        layoutidx_free();
+    }
+    romstats_close();
+    return rc;
+}
@@ -0,0 +1,160 @@
+#include "interleave.h"
+
+#ifdef CPU_X86
+#include <immintrin.h>
+#endif
+
+void deinterleave_scalar(const uint8_t *in, uint8_t *out, int size, int odd_offset) {
+    for (int i = 0; i < size; i++) {
+        if (i % 2) {
+            out[i] = in[i/2 + odd_offset];
+        } else {
+            out[i] = in[i/2];
+        }
+    }
+}
+
+void interleave_scalar(const uint8_t *in, uint8_t *out, int size, int odd_offset) {
+    for (int i = 0; i < size; i++) {
+        if (i % 2) {
+            out[i/2 + odd_offset] = in[i];
+        } else {
+            out[i/2] = in[i];
+        }
+    }
+}
+
+#ifdef CPU_X86
+
+// Хвост, не кратный ширине вектора, досчитывается скалярно с позиции k
+static void deinterleave_tail(const uint8_t *in, uint8_t *out, int size, int odd_offset, int k) {
+    for (int i = 2 * k; i < size; i++) {
+        out[i] = (i % 2) ? in[i/2 + odd_offset] : in[i/2];
+    }
+}
+
+static void interleave_tail(const uint8_t *in, uint8_t *out, int size, int odd_offset, int k) {
+    for (int i = 2 * k; i < size; i++) {
+        if (i % 2) {
+            out[i/2 + odd_offset] = in[i];
+        } else {
+            out[i/2] = in[i];
+        }
+    }
+}
+
+// Распаковка: чередуем 16 чётных и 16 нечётных байт (punpcklbw/punpckhbw)
+__attribute__((target("sse2")))
+void deinterleave_sse2(const uint8_t *in, uint8_t *out, int size, int odd_offset) {
+    const int pairs = size / 2;
+    int k = 0;
+
+    for (; k + 16 <= pairs; k += 16) {
+        __m128i even = _mm_loadu_si128((const __m128i *)(in + k));
+        __m128i odd = _mm_loadu_si128((const __m128i *)(in + odd_offset + k));
+        _mm_storeu_si128((__m128i *)(out + 2 * k), _mm_unpacklo_epi8(even, odd));
+        _mm_storeu_si128((__m128i *)(out + 2 * k + 16), _mm_unpackhi_epi8(even, odd));
+    }
+    deinterleave_tail(in, out, size, odd_offset, k);
+}
+
+__attribute__((target("avx2")))
+void deinterleave_avx2(const uint8_t *in, uint8_t *out, int size, int odd_offset) {
+    const int pairs = size / 2;
+    int k = 0;
+
+    for (; k + 32 <= pairs; k += 32) {
+        __m256i even = _mm256_loadu_si256((const __m256i *)(in + k));
+        __m256i odd = _mm256_loadu_si256((const __m256i *)(in + odd_offset + k));
+        // vpunpck* работают внутри 128-битных половин, порядок восстанавливаем перестановкой
+        __m256i lo = _mm256_unpacklo_epi8(even, odd);
+        __m256i hi = _mm256_unpackhi_epi8(even, odd);
+        _mm256_storeu_si256((__m256i *)(out + 2 * k), _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256((__m256i *)(out + 2 * k + 32), _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    deinterleave_sse2(in + k, out + 2 * k, size - 2 * k, odd_offset);
+}
+
+// Упаковка: чётные байты - младшие половины 16-битных слов, нечётные - старшие
+__attribute__((target("sse2")))
+void interleave_sse2(const uint8_t *in, uint8_t *out, int size, int odd_offset) {
+    const int pairs = size / 2;
+    const __m128i low_mask = _mm_set1_epi16(0x00FF);
+    int k = 0;
+
+    for (; k + 16 <= pairs; k += 16) {
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(in + 2 * k));
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(in + 2 * k + 16));
+        __m128i even = _mm_packus_epi16(_mm_and_si128(v0, low_mask), _mm_and_si128(v1, low_mask));
+        __m128i odd = _mm_packus_epi16(_mm_srli_epi16(v0, 8), _mm_srli_epi16(v1, 8));
+        _mm_storeu_si128((__m128i *)(out + k), even);
+        _mm_storeu_si128((__m128i *)(out + odd_offset + k), odd);
+    }
+    interleave_tail(in, out, size, odd_offset, k);
+}
+
+// vpshufb собирает в каждой 128-битной половине сначала чётные, затем нечётные байты
+__attribute__((target("avx2")))
+void interleave_avx2(const uint8_t *in, uint8_t *out, int size, int odd_offset) {
+    const int pairs = size / 2;
+    const __m256i split = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
+                                           0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+    int k = 0;
+
+    for (; k + 32 <= pairs; k += 32) {
+        __m256i v0 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(in + 2 * k)), split);
+        __m256i v1 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(in + 2 * k + 32)), split);
+        // Порядок 64-битных частей: чётные0 чётные1 нечётные0 нечётные1
+        v0 = _mm256_permute4x64_epi64(v0, 0xD8);
+        v1 = _mm256_permute4x64_epi64(v1, 0xD8);
+        _mm256_storeu_si256((__m256i *)(out + k), _mm256_permute2x128_si256(v0, v1, 0x20));
+        _mm256_storeu_si256((__m256i *)(out + odd_offset + k), _mm256_permute2x128_si256(v0, v1, 0x31));
+    }
+    interleave_sse2(in + 2 * k, out + k, size - 2 * k, odd_offset);
+}
+
+#endif // CPU_X86
+
+void deinterleave(const uint8_t *in, uint8_t *out, int size, int odd_offset) {
+#ifdef CPU_X86
+    if (cpu_have_avx2()) {
+        deinterleave_avx2(in, out, size, odd_offset);
+        return;
+    }
+    if (cpu_have_sse2()) {
+        deinterleave_sse2(in, out, size, odd_offset);
+        return;
+    }
+#endif
+    deinterleave_scalar(in, out, size, odd_offset);
+}
+
+void interleave(const uint8_t *in, uint8_t *out, int size, int odd_offset) {
+#ifdef CPU_X86
+    // Если области чётных и нечётных байт перекрываются, результат зависит
+    // от порядка записи - оставляем его таким же, как у скалярной версии
+    if (odd_offset >= (size + 1) / 2) {
+        if (cpu_have_avx2()) {
+            interleave_avx2(in, out, size, odd_offset);
+            return;
+        }
+        if (cpu_have_sse2()) {
+            interleave_sse2(in, out, size, odd_offset);
+            return;
+        }
+    }
+#endif
+    interleave_scalar(in, out, size, odd_offset);
+}
+
+const char *interleave_impl(void) {
+#ifdef CPU_X86
+    if (cpu_have_avx2()) {
+        return "avx2";
+    }
+    if (cpu_have_sse2()) {
+        return "sse2";
+    }
+#endif
+    return "scalar";
+}
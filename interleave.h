@@ -0,0 +1,32 @@
+#ifndef ___INTERLEAVE_H___
+#define ___INTERLEAVE_H___
+
+#include <stdint.h>
+#include "cpudetect.h"
+
+// Адрес начала нечётных байт в ПЗУ видеокарты: чётные байты лежат
+// с адреса 0x0000, нечётные - с адреса 0x4000
+#define ODD_BANK_OFFSET 0x4000
+
+// Преобразование из чётно-нечётного порядка ПЗУ в линейный:
+// out[2k] = in[k], out[2k+1] = in[k + odd_offset].
+// Требуется odd_offset + size / 2 <= size.
+void deinterleave(const uint8_t *in, uint8_t *out, int size, int odd_offset);
+
+// Обратное преобразование из линейного порядка в порядок ПЗУ
+void interleave(const uint8_t *in, uint8_t *out, int size, int odd_offset);
+
+// Отдельные реализации, выбор между ними делают функции выше
+void deinterleave_scalar(const uint8_t *in, uint8_t *out, int size, int odd_offset);
+void interleave_scalar(const uint8_t *in, uint8_t *out, int size, int odd_offset);
+#ifdef CPU_X86
+void deinterleave_sse2(const uint8_t *in, uint8_t *out, int size, int odd_offset);
+void deinterleave_avx2(const uint8_t *in, uint8_t *out, int size, int odd_offset);
+void interleave_sse2(const uint8_t *in, uint8_t *out, int size, int odd_offset);
+void interleave_avx2(const uint8_t *in, uint8_t *out, int size, int odd_offset);
+#endif
+
+// Название выбранной реализации
+const char *interleave_impl(void);
+
+#endif // ___INTERLEAVE_H___
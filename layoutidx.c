@@ -0,0 +1,364 @@
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "layoutidx.h"
+
+typedef struct {
+    uint64_t rom_hash;
+    int linear;
+    int size;
+    int offset[VGAROM_FONT_COUNT];
+    int alt_offset[VGAROM_ALT_COUNT];
+    int has_alt;            // 0 - строка старого формата
+} font_rec_t;
+
+typedef struct {
+    uint64_t rom_hash;
+    int linear;
+    uint64_t dos_hash;
+    int nhits;
+    vgarom_dos_hit_t *hits;
+} dos_rec_t;
+
+static pthread_mutex_t index_lock = PTHREAD_MUTEX_INITIALIZER;
+static font_rec_t *font_recs = NULL;
+static int nfont_recs = 0;
+static dos_rec_t *dos_recs = NULL;
+static int ndos_recs = 0;
+static int dirty = 0;
+static layoutidx_stats_t counters;
+
+static font_rec_t *find_font_rec(uint64_t rom_hash, int linear, int size) {
+    for (int i = 0; i < nfont_recs; i++) {
+        if (font_recs[i].rom_hash == rom_hash && font_recs[i].linear == linear &&
+            font_recs[i].size == size) {
+            return &font_recs[i];
+        }
+    }
+    return NULL;
+}
+
+static dos_rec_t *find_dos_rec(uint64_t rom_hash, int linear, uint64_t dos_hash) {
+    for (int i = 0; i < ndos_recs; i++) {
+        if (dos_recs[i].rom_hash == rom_hash && dos_recs[i].linear == linear &&
+            dos_recs[i].dos_hash == dos_hash) {
+            return &dos_recs[i];
+        }
+    }
+    return NULL;
+}
+
+static font_rec_t *add_font_rec(void) {
+    font_rec_t *p = realloc(font_recs, (nfont_recs + 1) * sizeof(*font_recs));
+    if (!p) {
+        return NULL;
+    }
+    font_recs = p;
+    return &font_recs[nfont_recs++];
+}
+
+static dos_rec_t *add_dos_rec(void) {
+    dos_rec_t *p = realloc(dos_recs, (ndos_recs + 1) * sizeof(*dos_recs));
+    if (!p) {
+        return NULL;
+    }
+    dos_recs = p;
+    memset(&dos_recs[ndos_recs], 0, sizeof(*dos_recs));
+    return &dos_recs[ndos_recs++];
+}
+
+// Смещение в индексе - шестнадцатеричное число или "-" для -1
+static int parse_offset(const char *tok, int *offset) {
+    char *end;
+    if (strcmp(tok, "-") == 0) {
+        *offset = -1;
+        return 0;
+    }
+    *offset = (int)strtol(tok, &end, 16);
+    return (*end == '\0' && *offset >= 0) ? 0 : -1;
+}
+
+static int parse_mode(const char *tok, int *linear) {
+    if (strcmp(tok, "L") != 0 && strcmp(tok, "I") != 0) {
+        return -1;
+    }
+    *linear = (tok[0] == 'L');
+    return 0;
+}
+
+static int parse_font_line(char *save) {
+    font_rec_t rec;
+    char *tok[6 + VGAROM_ALT_COUNT];
+    for (int i = 0; i < 6; i++) {
+        if (!(tok[i] = strtok_r(NULL, " \t\r\n", &save))) return -1;
+    }
+    rec.rom_hash = strtoull(tok[0], NULL, 16);
+    rec.size = atoi(tok[2]);
+    if (parse_mode(tok[1], &rec.linear) != 0) return -1;
+    for (int f = 0; f < VGAROM_FONT_COUNT; f++) {
+        if (parse_offset(tok[3 + f], &rec.offset[f]) != 0) return -1;
+    }
+    // Таблицы исправлений появились в индексе позже
+    rec.has_alt = 0;
+    for (int a = 0; a < VGAROM_ALT_COUNT; a++) {
+        rec.alt_offset[a] = -1;
+    }
+    if ((tok[6] = strtok_r(NULL, " \t\r\n", &save)) != NULL) {
+        if (!(tok[7] = strtok_r(NULL, " \t\r\n", &save))) return -1;
+        for (int a = 0; a < VGAROM_ALT_COUNT; a++) {
+            if (parse_offset(tok[6 + a], &rec.alt_offset[a]) != 0) return -1;
+        }
+        rec.has_alt = 1;
+    }
+
+    font_rec_t *p = find_font_rec(rec.rom_hash, rec.linear, rec.size);
+    if (!p && !(p = add_font_rec())) return -1;
+    *p = rec;
+    return 0;
+}
+
+static int parse_dos_line(char *save) {
+    char *tok[4];
+    for (int i = 0; i < 4; i++) {
+        if (!(tok[i] = strtok_r(NULL, " \t\r\n", &save))) return -1;
+    }
+    uint64_t rom_hash = strtoull(tok[0], NULL, 16);
+    uint64_t dos_hash = strtoull(tok[2], NULL, 16);
+    int linear;
+    int nhits = atoi(tok[3]);
+    if (parse_mode(tok[1], &linear) != 0 || nhits < 0) return -1;
+
+    vgarom_dos_hit_t *hits = malloc((nhits + 1) * sizeof(*hits));
+    if (!hits) return -1;
+    for (int i = 0; i < nhits; i++) {
+        char *t = strtok_r(NULL, " \t\r\n", &save);
+        char *colon = t ? strchr(t, ':') : NULL;
+        if (!colon) {
+            free(hits);
+            return -1;
+        }
+        *colon = '\0';
+        hits[i].char_idx = atoi(colon + 1);
+        hits[i].distance = 0;
+        if (parse_offset(t, &hits[i].offset) != 0) {
+            free(hits);
+            return -1;
+        }
+    }
+
+    dos_rec_t *p = find_dos_rec(rom_hash, linear, dos_hash);
+    if (!p && !(p = add_dos_rec())) {
+        free(hits);
+        return -1;
+    }
+    free(p->hits);
+    p->rom_hash = rom_hash;
+    p->linear = linear;
+    p->dos_hash = dos_hash;
+    p->nhits = nhits;
+    p->hits = hits;
+    return 0;
+}
+
+int layoutidx_load(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        if (errno == ENOENT) {
+            return 0;
+        }
+        perror("Error opening layout index");
+        return -1;
+    }
+
+    char *line = NULL;
+    size_t cap = 0;
+    int lineno = 0;
+    pthread_mutex_lock(&index_lock);
+    while (getline(&line, &cap, f) > 0) {
+        lineno++;
+        char *save;
+        char *type = strtok_r(line, " \t\r\n", &save);
+        if (!type || type[0] == '#') {
+            continue;
+        }
+        int rc = -1;
+        if (strcmp(type, "F") == 0) {
+            rc = parse_font_line(save);
+        } else if (strcmp(type, "D") == 0) {
+            rc = parse_dos_line(save);
+        }
+        // Испорченная строка пропускается, при записи она пропадёт
+        if (rc != 0) {
+            fprintf(stderr, "%s:%d: invalid layout record, skipped\n", path, lineno);
+            dirty = 1;
+        }
+    }
+    pthread_mutex_unlock(&index_lock);
+    free(line);
+    fclose(f);
+    return 0;
+}
+
+static void write_offset(FILE *f, int offset) {
+    if (offset < 0) {
+        fputs(" -", f);
+    } else {
+        fprintf(f, " %X", offset);
+    }
+}
+
+int layoutidx_save(const char *path) {
+    char tmp[4096 + 8];
+    int rc = 0;
+
+    pthread_mutex_lock(&index_lock);
+    if (!dirty) {
+        pthread_mutex_unlock(&index_lock);
+        return 0;
+    }
+
+    // Новый индекс заменяет старый целиком через rename
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    FILE *f = fopen(tmp, "w");
+    if (!f) {
+        perror("Error writing layout index");
+        pthread_mutex_unlock(&index_lock);
+        return -1;
+    }
+    fprintf(f, "# fontupdate layout index\n");
+    for (int i = 0; i < nfont_recs; i++) {
+        const font_rec_t *r = &font_recs[i];
+        fprintf(f, "F %016" PRIx64 " %c %d", r->rom_hash, r->linear ? 'L' : 'I', r->size);
+        for (int k = 0; k < VGAROM_FONT_COUNT; k++) {
+            write_offset(f, r->offset[k]);
+        }
+        for (int k = 0; r->has_alt && k < VGAROM_ALT_COUNT; k++) {
+            write_offset(f, r->alt_offset[k]);
+        }
+        fputc('\n', f);
+    }
+    for (int i = 0; i < ndos_recs; i++) {
+        const dos_rec_t *r = &dos_recs[i];
+        fprintf(f, "D %016" PRIx64 " %c %016" PRIx64 " %d",
+                r->rom_hash, r->linear ? 'L' : 'I', r->dos_hash, r->nhits);
+        for (int k = 0; k < r->nhits; k++) {
+            fprintf(f, " %X:%d", r->hits[k].offset, r->hits[k].char_idx);
+        }
+        fputc('\n', f);
+    }
+    if (fclose(f) != 0 || rename(tmp, path) != 0) {
+        perror("Error writing layout index");
+        unlink(tmp);
+        rc = -1;
+    } else {
+        dirty = 0;
+    }
+    pthread_mutex_unlock(&index_lock);
+    return rc;
+}
+
+int layoutidx_get_fonts(uint64_t rom_hash, int linear, int size, int offset[VGAROM_FONT_COUNT],
+                        int alt_offset[VGAROM_ALT_COUNT]) {
+    pthread_mutex_lock(&index_lock);
+    const font_rec_t *r = find_font_rec(rom_hash, linear, size);
+    if (r && !r->has_alt) {
+        r = NULL;
+    }
+    if (r) {
+        memcpy(offset, r->offset, sizeof(r->offset));
+        memcpy(alt_offset, r->alt_offset, sizeof(r->alt_offset));
+        counters.hits++;
+    } else {
+        counters.misses++;
+    }
+    pthread_mutex_unlock(&index_lock);
+    return r ? 0 : -1;
+}
+
+void layoutidx_put_fonts(uint64_t rom_hash, int linear, int size, const int offset[VGAROM_FONT_COUNT],
+                         const int alt_offset[VGAROM_ALT_COUNT]) {
+    pthread_mutex_lock(&index_lock);
+    font_rec_t *r = find_font_rec(rom_hash, linear, size);
+    if (!r) {
+        r = add_font_rec();
+    }
+    if (r) {
+        r->rom_hash = rom_hash;
+        r->linear = linear;
+        r->size = size;
+        memcpy(r->offset, offset, sizeof(r->offset));
+        memcpy(r->alt_offset, alt_offset, sizeof(r->alt_offset));
+        r->has_alt = 1;
+        counters.updated++;
+        dirty = 1;
+    }
+    pthread_mutex_unlock(&index_lock);
+}
+
+int layoutidx_get_dos(uint64_t rom_hash, int linear, uint64_t dos_hash,
+                      vgarom_dos_hit_t *hits, int max_hits) {
+    int nhits = -1;
+    pthread_mutex_lock(&index_lock);
+    const dos_rec_t *r = find_dos_rec(rom_hash, linear, dos_hash);
+    if (r && r->nhits <= max_hits) {
+        memcpy(hits, r->hits, r->nhits * sizeof(*hits));
+        nhits = r->nhits;
+        counters.hits++;
+    } else {
+        counters.misses++;
+    }
+    pthread_mutex_unlock(&index_lock);
+    return nhits;
+}
+
+void layoutidx_put_dos(uint64_t rom_hash, int linear, uint64_t dos_hash,
+                       const vgarom_dos_hit_t *hits, int nhits) {
+    vgarom_dos_hit_t *copy = malloc((nhits + 1) * sizeof(*copy));
+    if (!copy) {
+        return;
+    }
+    memcpy(copy, hits, nhits * sizeof(*copy));
+
+    pthread_mutex_lock(&index_lock);
+    dos_rec_t *r = find_dos_rec(rom_hash, linear, dos_hash);
+    if (!r) {
+        r = add_dos_rec();
+    }
+    if (r) {
+        free(r->hits);
+        r->rom_hash = rom_hash;
+        r->linear = linear;
+        r->dos_hash = dos_hash;
+        r->nhits = nhits;
+        r->hits = copy;
+        counters.updated++;
+        dirty = 1;
+    } else {
+        free(copy);
+    }
+    pthread_mutex_unlock(&index_lock);
+}
+
+void layoutidx_stats(layoutidx_stats_t *stats) {
+    pthread_mutex_lock(&index_lock);
+    *stats = counters;
+    pthread_mutex_unlock(&index_lock);
+}
+
+void layoutidx_free(void) {
+    pthread_mutex_lock(&index_lock);
+    for (int i = 0; i < ndos_recs; i++) {
+        free(dos_recs[i].hits);
+    }
+    free(dos_recs);
+    free(font_recs);
+    dos_recs = NULL;
+    font_recs = NULL;
+    ndos_recs = nfont_recs = 0;
+    dirty = 0;
+    pthread_mutex_unlock(&index_lock);
+}
@@ -0,0 +1,47 @@
+#ifndef ___LAYOUTIDX_H___
+#define ___LAYOUTIDX_H___
+
+#include <stdint.h>
+#include "vgarom.h"
+
+// Индекс разметки образов: по хешу исходного (линейного) образа и
+// порядку байт хранятся смещения таблиц шрифтов, а по хешу образа и
+// DOS-шрифта - найденные вхождения глифов. Индекс - текстовый файл,
+// по строке на запись:
+//   F <хеш образа> <L|I> <размер> <8x8> <8x14> <8x16> <9x14> <9x16>
+//   D <хеш образа> <L|I> <хеш DOS-шрифта> <число> <смещение>:<символ> ...
+// Функции можно вызывать из нескольких потоков.
+
+typedef struct {
+    int hits;
+    int misses;
+    int updated;        // записи, добавленные или заменённые
+} layoutidx_stats_t;
+
+// Загружает индекс. Отсутствующий файл - пустой индекс.
+int layoutidx_load(const char *path);
+
+// Записывает индекс, если он изменился
+int layoutidx_save(const char *path);
+
+// Возвращает 0 и смещения таблиц шрифтов и таблиц исправлений 9x14 и
+// 9x16 или -1, если записи нет. Запись старого формата, без таблиц
+// исправлений, считается отсутствующей и при записи заменяется.
+int layoutidx_get_fonts(uint64_t rom_hash, int linear, int size, int offset[VGAROM_FONT_COUNT],
+                        int alt_offset[VGAROM_ALT_COUNT]);
+void layoutidx_put_fonts(uint64_t rom_hash, int linear, int size, const int offset[VGAROM_FONT_COUNT],
+                         const int alt_offset[VGAROM_ALT_COUNT]);
+
+// Возвращает число вхождений или -1, если записи нет (или она не
+// помещается в max_hits)
+int layoutidx_get_dos(uint64_t rom_hash, int linear, uint64_t dos_hash,
+                      vgarom_dos_hit_t *hits, int max_hits);
+void layoutidx_put_dos(uint64_t rom_hash, int linear, uint64_t dos_hash,
+                       const vgarom_dos_hit_t *hits, int nhits);
+
+void layoutidx_stats(layoutidx_stats_t *stats);
+
+// Освобождает индекс в памяти
+void layoutidx_free(void);
+
+#endif // ___LAYOUTIDX_H___
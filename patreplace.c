@@ -0,0 +1,102 @@
+#include <stdlib.h>
+#include <string.h>
+#include "patreplace.h"
+#include "fontscan.h"
+
+// find_signature работает с длинами int, поэтому большие буферы
+// просматриваются окнами
+#define SEARCH_WINDOW (1 << 30)
+
+// Шаблоны короче якоря find_signature ищутся по первому байту через
+// memchr, который в libc тоже векторный
+static long find_short(const uint8_t *data, size_t len, const uint8_t *find, size_t find_len) {
+    const uint8_t *p = data;
+    const uint8_t *end = data + len - find_len + 1;
+
+    while (p < end && (p = memchr(p, find[0], end - p)) != NULL) {
+        if (memcmp(p, find, find_len) == 0) {
+            return p - data;
+        }
+        p++;
+    }
+    return -1;
+}
+
+// Первое вхождение find в data или -1
+static long find_next(const uint8_t *data, size_t len, const uint8_t *find, size_t find_len) {
+    size_t pos = 0;
+
+    if (find_len < FONT_ANCHOR_LEN) {
+        return len < find_len ? -1 : find_short(data, len, find, find_len);
+    }
+    while (pos + find_len <= len) {
+        size_t window = len - pos > SEARCH_WINDOW ? SEARCH_WINDOW : len - pos;
+        int i = find_signature(data + pos, (int)window, find, (int)find_len, 0);
+        if (i >= 0) {
+            return pos + i;
+        }
+        if (window == len - pos) {
+            break;
+        }
+        // Окна перекрываются, чтобы не пропустить вхождение на стыке
+        pos += window - find_len + 1;
+    }
+    return -1;
+}
+
+long patreplace_find(const uint8_t *data, size_t len,
+                     const uint8_t *find, size_t find_len, size_t **matches) {
+    size_t *list = NULL;
+    long n = 0, cap = 0;
+    size_t pos = 0;
+
+    *matches = NULL;
+    if (find_len == 0 || find_len > SEARCH_WINDOW) {
+        return 0;
+    }
+    while (pos + find_len <= len) {
+        long i = find_next(data + pos, len - pos, find, find_len);
+        if (i < 0) {
+            break;
+        }
+        if (n == cap) {
+            cap = cap ? cap * 2 : 256;
+            size_t *grown = realloc(list, cap * sizeof(*list));
+            if (!grown) {
+                free(list);
+                return -1;
+            }
+            list = grown;
+        }
+        list[n++] = pos + i;
+        pos += i + find_len;
+    }
+    *matches = list;
+    return n;
+}
+
+size_t patreplace_size(size_t len, long nmatches, size_t find_len, size_t repl_len) {
+    return len - nmatches * find_len + nmatches * repl_len;
+}
+
+void patreplace_copy(const uint8_t *data, size_t len,
+                     const size_t *matches, long nmatches, size_t find_len,
+                     const uint8_t *repl, size_t repl_len, uint8_t *out) {
+    size_t pos = 0;
+
+    for (long k = 0; k < nmatches; k++) {
+        size_t gap = matches[k] - pos;
+        memcpy(out, data + pos, gap);
+        memcpy(out + gap, repl, repl_len);
+        out += gap + repl_len;
+        pos = matches[k] + find_len;
+    }
+    memcpy(out, data + pos, len - pos);
+}
+
+void patreplace_inplace(uint8_t *data, const size_t *matches, long nmatches,
+                        const uint8_t *repl, size_t repl_len) {
+    for (long k = 0; k < nmatches; k++) {
+        memcpy(data + matches[k], repl, repl_len);
+    }
+}
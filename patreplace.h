@@ -0,0 +1,31 @@
+#ifndef ___PATREPLACE_H___
+#define ___PATREPLACE_H___
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Замена всех вхождений шаблона в буфере (utils/pattern_replace).
+// Вхождения ищутся слева направо без пересечений, как в побайтовом
+// цикле: после найденного поиск продолжается за его концом. Поиск
+// векторный (find_signature), а результат собирается копированием
+// целых промежутков между вхождениями.
+
+// Находит вхождения find в data. Возвращает их число и массив смещений
+// в *matches (освобождается free) или -1 при нехватке памяти.
+long patreplace_find(const uint8_t *data, size_t len,
+                     const uint8_t *find, size_t find_len, size_t **matches);
+
+// Размер результата замены nmatches вхождений
+size_t patreplace_size(size_t len, long nmatches, size_t find_len, size_t repl_len);
+
+// Собирает результат в out (patreplace_size байт): промежутки из data
+// и repl на месте каждого вхождения
+void patreplace_copy(const uint8_t *data, size_t len,
+                     const size_t *matches, long nmatches, size_t find_len,
+                     const uint8_t *repl, size_t repl_len, uint8_t *out);
+
+// Замена той же длины прямо в data: пишутся только сами вхождения
+void patreplace_inplace(uint8_t *data, const size_t *matches, long nmatches,
+                        const uint8_t *repl, size_t repl_len);
+
+#endif // ___PATREPLACE_H___
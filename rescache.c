@@ -0,0 +1,238 @@
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/fs.h>
+#endif
+#include "rescache.h"
+#include "fontscan.h"
+
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static rescache_stats_t counters;
+
+#define COUNT(field) do { \
+    pthread_mutex_lock(&stats_lock); \
+    counters.field++; \
+    pthread_mutex_unlock(&stats_lock); \
+} while (0)
+
+static void entry_path(char *buf, size_t len, const char *dir, uint64_t key) {
+    snprintf(buf, len, "%s/%016llx.rom", dir, (unsigned long long)key);
+}
+
+// Копирует файл src в dst. Запись кэша и выходной файл никогда не
+// делят inode: иначе правка выхода на месте (pattern_replace,
+// addchecksum) испортила бы запись и все выходы, взятые из неё.
+// Где файловая система умеет, копия делается клонированием (reflink):
+// блоки общие, пока один из файлов не изменится.
+// Возвращает 0 или -1.
+static int copy_file(const char *src, const char *dst) {
+    uint8_t buf[65536];
+    int in = open(src, O_RDONLY);
+    if (in == -1) {
+        return -1;
+    }
+    int out = open(dst, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out == -1) {
+        close(in);
+        return -1;
+    }
+
+    int rc = 0;
+    ssize_t n = 0;
+#ifdef FICLONE
+    if (ioctl(out, FICLONE, in) == 0) {
+        close(in);
+        return close(out) == 0 ? 0 : -1;
+    }
+#endif
+    while ((n = read(in, buf, sizeof(buf))) > 0) {
+        if (write(out, buf, n) != n) {
+            rc = -1;
+            break;
+        }
+    }
+    if (n < 0) {
+        rc = -1;
+    }
+    close(in);
+    if (close(out) != 0) {
+        rc = -1;
+    }
+    return rc;
+}
+
+// Запись цела, если сумма всех её байт равна нулю: так заканчивается
+// любой образ, записанный fontupdate. Защищает от испорченных или
+// обрезанных файлов в каталоге кэша.
+static int entry_valid(const char *path) {
+    uint8_t buf[65536];
+    uint8_t sum = 0;
+    long total = 0;
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) {
+        return 0;
+    }
+    ssize_t n;
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+        sum += byte_sum(buf, n);
+        total += n;
+    }
+    close(fd);
+    return n == 0 && total >= 2 && sum == 0;
+}
+
+int rescache_init(const char *dir) {
+    if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+        perror("Error creating cache directory");
+        return -1;
+    }
+    return 0;
+}
+
+int rescache_fetch(const char *dir, uint64_t key, const char *output) {
+    char entry[4096];
+    entry_path(entry, sizeof(entry), dir, key);
+
+    if (!entry_valid(entry)) {
+        if (access(entry, F_OK) == 0) {
+            unlink(entry);
+        }
+        COUNT(misses);
+        return -1;
+    }
+
+    // Старый выход заменяется, а не переписывается: он может быть
+    // жёсткой ссылкой на запись кэша прежних версий
+    if (unlink(output) != 0 && errno != ENOENT) {
+        COUNT(misses);
+        return -1;
+    }
+    if (copy_file(entry, output) != 0) {
+        COUNT(misses);
+        return -1;
+    }
+
+    // Время изменения записи - время последнего использования
+    utimensat(AT_FDCWD, entry, NULL, 0);
+    COUNT(hits);
+    return 0;
+}
+
+int rescache_store(const char *dir, uint64_t key, const char *output) {
+    static unsigned seq = 0;
+    char entry[4096];
+    char tmp[4096 + 64];
+    entry_path(entry, sizeof(entry), dir, key);
+
+    pthread_mutex_lock(&stats_lock);
+    unsigned n = seq++;
+    pthread_mutex_unlock(&stats_lock);
+    snprintf(tmp, sizeof(tmp), "%s.%ld.%u.tmp", entry, (long)getpid(), n);
+
+    // Запись появляется в кэше целиком через rename
+    if (copy_file(output, tmp) != 0) {
+        unlink(tmp);
+        return -1;
+    }
+    if (rename(tmp, entry) != 0) {
+        unlink(tmp);
+        return -1;
+    }
+    COUNT(stored);
+    return 0;
+}
+
+typedef struct {
+    char *name;
+    long size;
+    struct timespec mtime;
+} cache_entry_t;
+
+static int entry_older(const void *a, const void *b) {
+    const cache_entry_t *x = a, *y = b;
+    if (x->mtime.tv_sec != y->mtime.tv_sec) {
+        return x->mtime.tv_sec < y->mtime.tv_sec ? -1 : 1;
+    }
+    if (x->mtime.tv_nsec != y->mtime.tv_nsec) {
+        return x->mtime.tv_nsec < y->mtime.tv_nsec ? -1 : 1;
+    }
+    return 0;
+}
+
+int rescache_evict(const char *dir, long max_bytes) {
+    DIR *d = opendir(dir);
+    if (!d) {
+        perror("Error opening cache directory");
+        return -1;
+    }
+
+    cache_entry_t *entries = NULL;
+    int count = 0, cap = 0;
+    long total = 0;
+    struct dirent *de;
+    while ((de = readdir(d)) != NULL) {
+        size_t len = strlen(de->d_name);
+        if (len < 4 || strcmp(de->d_name + len - 4, ".rom") != 0) {
+            continue;
+        }
+        char path[4096];
+        struct stat st;
+        snprintf(path, sizeof(path), "%s/%s", dir, de->d_name);
+        if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+        if (count == cap) {
+            cap = cap ? cap * 2 : 256;
+            cache_entry_t *p = realloc(entries, cap * sizeof(*entries));
+            if (!p) {
+                perror("Memory allocation failed");
+                break;
+            }
+            entries = p;
+        }
+        entries[count].name = strdup(path);
+        entries[count].size = st.st_size;
+        entries[count].mtime = st.st_mtim;
+        if (entries[count].name) {
+            total += st.st_size;
+            count++;
+        }
+    }
+    closedir(d);
+
+    if (count > 0) {
+        qsort(entries, count, sizeof(*entries), entry_older);
+    }
+    int evicted = 0;
+    for (int i = 0; i < count && total > max_bytes; i++) {
+        if (unlink(entries[i].name) == 0) {
+            total -= entries[i].size;
+            evicted++;
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        free(entries[i].name);
+    }
+    free(entries);
+
+    pthread_mutex_lock(&stats_lock);
+    counters.evicted += evicted;
+    counters.entries = count - evicted;
+    counters.bytes = total;
+    pthread_mutex_unlock(&stats_lock);
+    return 0;
+}
+
+void rescache_stats(rescache_stats_t *stats) {
+    pthread_mutex_lock(&stats_lock);
+    *stats = counters;
+    pthread_mutex_unlock(&stats_lock);
+}
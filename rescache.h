@@ -0,0 +1,38 @@
+#ifndef ___RESCACHE_H___
+#define ___RESCACHE_H___
+
+#include <stdint.h>
+
+// Кэш готовых образов на диске. Запись - файл <ключ>.rom в каталоге
+// кэша, ключ - хеш входного образа, шрифтов и флагов. Запись и выходной
+// файл копируются друг в друга (клонированием, где файловая система
+// это умеет) и никогда не делят inode. Время изменения записи
+// обновляется при каждом использовании, по нему вытесняются самые
+// давно использованные записи.
+
+typedef struct {
+    int hits;
+    int misses;
+    int stored;
+    int evicted;
+    int entries;        // записей в каталоге после вытеснения
+    long bytes;         // их общий размер
+} rescache_stats_t;
+
+// Создаёт каталог кэша, если его нет. Возвращает 0 или -1.
+int rescache_init(const char *dir);
+
+// Если запись с ключом key есть и цела, ставит её на место output
+// и возвращает 0, иначе -1
+int rescache_fetch(const char *dir, uint64_t key, const char *output);
+
+// Сохраняет готовый файл output как запись с ключом key
+int rescache_store(const char *dir, uint64_t key, const char *output);
+
+// Удаляет самые давно использованные записи, пока их общий размер
+// больше max_bytes, и заполняет entries и bytes в статистике
+int rescache_evict(const char *dir, long max_bytes);
+
+void rescache_stats(rescache_stats_t *stats);
+
+#endif // ___RESCACHE_H___
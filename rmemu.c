@@ -0,0 +1,946 @@
+#include <stdlib.h>
+#include <string.h>
+#include "rmemu.h"
+
+#define MEM_SIZE 0x100000
+
+// Флаги процессора
+#define F_CF 0x0001
+#define F_PF 0x0004
+#define F_AF 0x0010
+#define F_ZF 0x0040
+#define F_SF 0x0080
+#define F_TF 0x0100
+#define F_IF 0x0200
+#define F_DF 0x0400
+#define F_OF 0x0800
+
+// Свойства кодов команд для декодера
+#define OP_MODRM  0x01      // есть байт modrm
+#define OP_IB     0x02      // непосредственный байт
+#define OP_IW     0x04      // непосредственное слово
+#define OP_PREFIX 0x08
+#define OP_BAD    0x10      // нет в 8086/80186
+#define OP_FAR    0x20      // дальний адрес: смещение и сегмент
+#define OP_MOFFS  0x40      // адрес памяти вместо modrm (A0-A3)
+
+#define ALU(base) [base] = OP_MODRM, [base + 1] = OP_MODRM, [base + 2] = OP_MODRM, \
+                  [base + 3] = OP_MODRM, [base + 4] = OP_IB, [base + 5] = OP_IW
+
+static const uint8_t op_info[256] = {
+    ALU(0x00), ALU(0x08), ALU(0x10), ALU(0x18), ALU(0x20), ALU(0x28), ALU(0x30), ALU(0x38),
+    [0x0F] = OP_BAD,
+    [0x26] = OP_PREFIX, [0x2E] = OP_PREFIX, [0x36] = OP_PREFIX, [0x3E] = OP_PREFIX,
+    [0x62] = OP_BAD | OP_MODRM, [0x63 ... 0x67] = OP_BAD,
+    [0x68] = OP_IW, [0x69] = OP_MODRM | OP_IW, [0x6A] = OP_IB, [0x6B] = OP_MODRM | OP_IB,
+    [0x70 ... 0x7F] = OP_IB,
+    [0x80] = OP_MODRM | OP_IB, [0x81] = OP_MODRM | OP_IW,
+    [0x82] = OP_MODRM | OP_IB, [0x83] = OP_MODRM | OP_IB,
+    [0x84 ... 0x8F] = OP_MODRM,
+    [0x9A] = OP_FAR,
+    [0xA0 ... 0xA3] = OP_MOFFS,
+    [0xA8] = OP_IB, [0xA9] = OP_IW,
+    [0xB0 ... 0xB7] = OP_IB, [0xB8 ... 0xBF] = OP_IW,
+    [0xC0] = OP_MODRM | OP_IB, [0xC1] = OP_MODRM | OP_IB,
+    [0xC2] = OP_IW, [0xC4 ... 0xC5] = OP_MODRM,
+    [0xC6] = OP_MODRM | OP_IB, [0xC7] = OP_MODRM | OP_IW,
+    [0xC8] = OP_IW | OP_IB, [0xCA] = OP_IW, [0xCD] = OP_IB,
+    [0xD0 ... 0xD3] = OP_MODRM, [0xD4 ... 0xD5] = OP_IB, [0xD6] = OP_BAD,
+    [0xD8 ... 0xDF] = OP_MODRM,
+    [0xE0 ... 0xE7] = OP_IB, [0xE8 ... 0xE9] = OP_IW, [0xEA] = OP_FAR, [0xEB] = OP_IB,
+    [0xF0] = OP_PREFIX, [0xF1] = OP_BAD, [0xF2 ... 0xF3] = OP_PREFIX,
+    [0xF6 ... 0xF7] = OP_MODRM, [0xFE ... 0xFF] = OP_MODRM,
+};
+
+int rmemu_decode(const uint8_t *code, int avail, rmemu_insn_t *insn) {
+    int pos = 0;
+
+    memset(insn, 0, sizeof(*insn));
+    insn->seg = -1;
+    for (;;) {
+        if (pos >= avail || pos > 4) {
+            return RMEMU_ERR_OPCODE;
+        }
+        uint8_t b = code[pos];
+        if (!(op_info[b] & OP_PREFIX)) {
+            break;
+        }
+        if (b == 0xF2 || b == 0xF3) {
+            insn->rep = b;
+        } else if (b != 0xF0) {
+            insn->seg = (b >> 3) & 3;
+        }
+        pos++;
+    }
+
+    insn->op = code[pos++];
+    uint8_t info = op_info[insn->op];
+    if (info & OP_BAD) {
+        return RMEMU_ERR_OPCODE;
+    }
+    if (info & OP_MODRM) {
+        if (pos >= avail) {
+            return RMEMU_ERR_OPCODE;
+        }
+        uint8_t m = code[pos++];
+        insn->has_modrm = 1;
+        insn->mod = m >> 6;
+        insn->reg = (m >> 3) & 7;
+        insn->rm = m & 7;
+        int disp = 0;
+        if (insn->mod == 1) {
+            disp = 1;
+        } else if (insn->mod == 2 || (insn->mod == 0 && insn->rm == 6)) {
+            disp = 2;
+        }
+        if (pos + disp > avail) {
+            return RMEMU_ERR_OPCODE;
+        }
+        if (disp == 1) {
+            insn->disp = (uint16_t)(int8_t)code[pos];
+        } else if (disp == 2) {
+            insn->disp = code[pos] | code[pos + 1] << 8;
+        }
+        pos += disp;
+    }
+    if (info & OP_MOFFS) {
+        if (pos + 2 > avail) {
+            return RMEMU_ERR_OPCODE;
+        }
+        insn->disp = code[pos] | code[pos + 1] << 8;
+        pos += 2;
+    }
+
+    // У TEST в группе F6/F7 есть непосредственный операнд
+    if ((insn->op == 0xF6 || insn->op == 0xF7) && insn->reg < 2) {
+        info |= insn->op == 0xF6 ? OP_IB : OP_IW;
+    }
+    if (info & (OP_IW | OP_FAR)) {
+        if (pos + 2 > avail) {
+            return RMEMU_ERR_OPCODE;
+        }
+        insn->imm = code[pos] | code[pos + 1] << 8;
+        pos += 2;
+    }
+    if (info & OP_FAR) {
+        if (pos + 2 > avail) {
+            return RMEMU_ERR_OPCODE;
+        }
+        insn->imm2 = code[pos] | code[pos + 1] << 8;
+        pos += 2;
+    }
+    if (info & OP_IB) {
+        if (pos >= avail) {
+            return RMEMU_ERR_OPCODE;
+        }
+        // У ENTER байт идёт вторым операндом
+        if (info & OP_IW) {
+            insn->imm2 = code[pos];
+        } else {
+            insn->imm = code[pos];
+        }
+        pos++;
+    }
+    insn->len = pos;
+    return pos;
+}
+
+int rmemu_init(rmemu_t *cpu, const uint8_t *rom, int size) {
+    memset(cpu, 0, sizeof(*cpu));
+    if (size < 0 || size > RMEMU_MAX_ROM) {
+        size = size < 0 ? 0 : RMEMU_MAX_ROM;
+    }
+    cpu->mem = calloc(1, MEM_SIZE);
+    if (!cpu->mem) {
+        return RMEMU_ERR_NOMEM;
+    }
+    memcpy(cpu->mem + (RMEMU_ROM_SEG << 4), rom, size);
+
+    // Область данных BIOS: режим 3, 25 строк по 16 точек, EGA/VGA с
+    // цветным монитором
+    uint8_t *bda = cpu->mem + 0x400;
+    bda[0x49] = 0x03;
+    bda[0x4A] = 80;
+    bda[0x4C] = 0x00;
+    bda[0x4D] = 0x10;
+    bda[0x63] = 0xD4;
+    bda[0x64] = 0x03;
+    bda[0x84] = 24;
+    bda[0x85] = 16;
+    bda[0x87] = 0x60;
+    bda[0x88] = 0x09;
+    bda[0x89] = 0x11;
+    return RMEMU_OK;
+}
+
+void rmemu_free(rmemu_t *cpu) {
+    free(cpu->mem);
+    cpu->mem = NULL;
+}
+
+static uint32_t lin(uint16_t seg, uint16_t off) {
+    return (((uint32_t)seg << 4) + off) & (MEM_SIZE - 1);
+}
+
+static uint8_t rd8(rmemu_t *cpu, uint16_t seg, uint16_t off) {
+    return cpu->mem[lin(seg, off)];
+}
+
+static uint16_t rd16(rmemu_t *cpu, uint16_t seg, uint16_t off) {
+    return rd8(cpu, seg, off) | rd8(cpu, seg, off + 1) << 8;
+}
+
+static void wr8(rmemu_t *cpu, uint16_t seg, uint16_t off, uint8_t v) {
+    cpu->mem[lin(seg, off)] = v;
+}
+
+static void wr16(rmemu_t *cpu, uint16_t seg, uint16_t off, uint16_t v) {
+    wr8(cpu, seg, off, v & 0xFF);
+    wr8(cpu, seg, off + 1, v >> 8);
+}
+
+static void push(rmemu_t *cpu, uint16_t v) {
+    cpu->reg[RMEMU_SP] -= 2;
+    wr16(cpu, cpu->sreg[RMEMU_SS], cpu->reg[RMEMU_SP], v);
+}
+
+static uint16_t pop(rmemu_t *cpu) {
+    uint16_t v = rd16(cpu, cpu->sreg[RMEMU_SS], cpu->reg[RMEMU_SP]);
+    cpu->reg[RMEMU_SP] += 2;
+    return v;
+}
+
+// 8-битные регистры: AL CL DL BL AH CH DH BH
+static uint8_t get_r8(const rmemu_t *cpu, int r) {
+    return r < 4 ? cpu->reg[r] & 0xFF : cpu->reg[r - 4] >> 8;
+}
+
+static void set_r8(rmemu_t *cpu, int r, uint8_t v) {
+    if (r < 4) {
+        cpu->reg[r] = (cpu->reg[r] & 0xFF00) | v;
+    } else {
+        cpu->reg[r - 4] = (cpu->reg[r - 4] & 0x00FF) | v << 8;
+    }
+}
+
+static uint16_t get_reg(const rmemu_t *cpu, int r, int w) {
+    return w ? cpu->reg[r] : get_r8(cpu, r);
+}
+
+static void set_reg(rmemu_t *cpu, int r, int w, uint16_t v) {
+    if (w) {
+        cpu->reg[r] = v;
+    } else {
+        set_r8(cpu, r, v);
+    }
+}
+
+// Адрес операнда в памяти: сегмент и смещение
+static void modrm_addr(const rmemu_t *cpu, const rmemu_insn_t *insn, uint16_t *seg, uint16_t *off) {
+    static const int base[8] = { RMEMU_BX, RMEMU_BX, RMEMU_BP, RMEMU_BP, RMEMU_SI, RMEMU_DI, RMEMU_BP, RMEMU_BX };
+    static const int index[8] = { RMEMU_SI, RMEMU_DI, RMEMU_SI, RMEMU_DI, -1, -1, -1, -1 };
+    int def = RMEMU_DS;
+    uint16_t a;
+
+    if (insn->mod == 0 && insn->rm == 6) {
+        a = insn->disp;
+    } else {
+        a = cpu->reg[base[insn->rm]] + insn->disp;
+        if (index[insn->rm] >= 0) {
+            a += cpu->reg[index[insn->rm]];
+        }
+        if (base[insn->rm] == RMEMU_BP) {
+            def = RMEMU_SS;
+        }
+    }
+    *seg = cpu->sreg[insn->seg >= 0 ? insn->seg : def];
+    *off = a;
+}
+
+static uint16_t get_rm(rmemu_t *cpu, const rmemu_insn_t *insn, int w) {
+    uint16_t seg, off;
+    if (insn->mod == 3) {
+        return get_reg(cpu, insn->rm, w);
+    }
+    modrm_addr(cpu, insn, &seg, &off);
+    return w ? rd16(cpu, seg, off) : rd8(cpu, seg, off);
+}
+
+static void set_rm(rmemu_t *cpu, const rmemu_insn_t *insn, int w, uint16_t v) {
+    uint16_t seg, off;
+    if (insn->mod == 3) {
+        set_reg(cpu, insn->rm, w, v);
+        return;
+    }
+    modrm_addr(cpu, insn, &seg, &off);
+    if (w) {
+        wr16(cpu, seg, off, v);
+    } else {
+        wr8(cpu, seg, off, v);
+    }
+}
+
+static void set_szp(rmemu_t *cpu, uint16_t v, int w) {
+    uint16_t sign = w ? 0x8000 : 0x80;
+    v &= w ? 0xFFFF : 0xFF;
+    cpu->flags &= ~(F_SF | F_ZF | F_PF);
+    if (v == 0) {
+        cpu->flags |= F_ZF;
+    }
+    if (v & sign) {
+        cpu->flags |= F_SF;
+    }
+    if (!(__builtin_popcount(v & 0xFF) & 1)) {
+        cpu->flags |= F_PF;
+    }
+}
+
+static void set_flag(rmemu_t *cpu, uint16_t flag, int on) {
+    if (on) {
+        cpu->flags |= flag;
+    } else {
+        cpu->flags &= ~flag;
+    }
+}
+
+// Арифметика и логика: 0 ADD, 1 OR, 2 ADC, 3 SBB, 4 AND, 5 SUB, 6 XOR, 7 CMP.
+// Возвращает результат; для CMP его не нужно записывать.
+static uint16_t alu(rmemu_t *cpu, int op, uint16_t a, uint16_t b, int w) {
+    uint32_t mask = w ? 0xFFFF : 0xFF;
+    uint32_t sign = w ? 0x8000 : 0x80;
+    uint32_t carry = (op == 2 || op == 3) && (cpu->flags & F_CF) ? 1 : 0;
+    uint32_t r;
+
+    a &= mask;
+    b &= mask;
+    switch (op) {
+        case 0:
+        case 2:
+            r = (uint32_t)a + b + carry;
+            set_flag(cpu, F_CF, r > mask);
+            set_flag(cpu, F_OF, ((a ^ r) & (b ^ r) & sign) != 0);
+            set_flag(cpu, F_AF, ((a ^ b ^ r) & 0x10) != 0);
+            break;
+        case 3:
+        case 5:
+        case 7:
+            r = (uint32_t)a - b - carry;
+            set_flag(cpu, F_CF, (uint32_t)a < (uint32_t)b + carry);
+            set_flag(cpu, F_OF, ((a ^ b) & (a ^ r) & sign) != 0);
+            set_flag(cpu, F_AF, ((a ^ b ^ r) & 0x10) != 0);
+            break;
+        default:
+            r = op == 1 ? (a | b) : op == 4 ? (a & b) : (a ^ b);
+            cpu->flags &= ~(F_CF | F_OF | F_AF);
+            break;
+    }
+    set_szp(cpu, r, w);
+    return r & mask;
+}
+
+// INC и DEC не меняют CF
+static uint16_t inc_dec(rmemu_t *cpu, uint16_t v, int dec, int w) {
+    uint16_t cf = cpu->flags & F_CF;
+    uint16_t r = alu(cpu, dec ? 5 : 0, v, 1, w);
+    cpu->flags = (cpu->flags & ~F_CF) | cf;
+    return r;
+}
+
+// Сдвиги: 0 ROL, 1 ROR, 2 RCL, 3 RCR, 4 SHL, 5 SHR, 6 SAL, 7 SAR
+static uint16_t shift(rmemu_t *cpu, int op, uint16_t v, int count, int w) {
+    uint16_t mask = w ? 0xFFFF : 0xFF;
+    uint16_t sign = w ? 0x8000 : 0x80;
+
+    count &= 0x1F;
+    if (count == 0) {
+        return v;
+    }
+    v &= mask;
+    for (int i = 0; i < count; i++) {
+        int cf = cpu->flags & F_CF ? 1 : 0;
+        int out;
+        switch (op) {
+            case 0:
+                out = (v & sign) != 0;
+                v = ((v << 1) | out) & mask;
+                break;
+            case 1:
+                out = v & 1;
+                v = (v >> 1) | (out ? sign : 0);
+                break;
+            case 2:
+                out = (v & sign) != 0;
+                v = ((v << 1) | cf) & mask;
+                break;
+            case 3:
+                out = v & 1;
+                v = (v >> 1) | (cf ? sign : 0);
+                break;
+            case 4:
+            case 6:
+                out = (v & sign) != 0;
+                v = (v << 1) & mask;
+                break;
+            case 5:
+                out = v & 1;
+                v >>= 1;
+                break;
+            default:
+                out = v & 1;
+                v = (v >> 1) | (v & sign);
+                break;
+        }
+        set_flag(cpu, F_CF, out);
+    }
+    if (op >= 4) {
+        set_szp(cpu, v, w);
+    }
+    if (op == 0 || op == 2 || op == 4 || op == 6) {
+        set_flag(cpu, F_OF, ((v & sign) != 0) != ((cpu->flags & F_CF) != 0));
+    } else {
+        set_flag(cpu, F_OF, ((v ^ (v << 1)) & sign) != 0);
+    }
+    return v;
+}
+
+static int condition(const rmemu_t *cpu, int cc) {
+    uint16_t f = cpu->flags;
+    int r;
+    switch (cc >> 1) {
+        case 0: r = (f & F_OF) != 0; break;
+        case 1: r = (f & F_CF) != 0; break;
+        case 2: r = (f & F_ZF) != 0; break;
+        case 3: r = (f & (F_CF | F_ZF)) != 0; break;
+        case 4: r = (f & F_SF) != 0; break;
+        case 5: r = (f & F_PF) != 0; break;
+        case 6: r = ((f & F_SF) != 0) != ((f & F_OF) != 0); break;
+        default: r = (f & F_ZF) || ((f & F_SF) != 0) != ((f & F_OF) != 0); break;
+    }
+    return (cc & 1) ? !r : r;
+}
+
+// Вызов прерывания n по вектору в памяти
+static int interrupt(rmemu_t *cpu, int n) {
+    uint16_t off = rd16(cpu, 0, n * 4);
+    uint16_t seg = rd16(cpu, 0, n * 4 + 2);
+    if (off == 0 && seg == 0) {
+        return RMEMU_ERR_INT;
+    }
+    push(cpu, cpu->flags);
+    push(cpu, cpu->sreg[RMEMU_CS]);
+    push(cpu, cpu->ip);
+    cpu->flags &= ~(F_IF | F_TF);
+    cpu->sreg[RMEMU_CS] = seg;
+    cpu->ip = off;
+    return RMEMU_OK;
+}
+
+// MUL, IMUL, DIV, IDIV (группа F6/F7)
+static int muldiv(rmemu_t *cpu, int op, uint16_t src, int w) {
+    if (!w) {
+        uint16_t ax = cpu->reg[RMEMU_AX];
+        int32_t r;
+        switch (op) {
+            case 4:
+                r = (ax & 0xFF) * (src & 0xFF);
+                cpu->reg[RMEMU_AX] = r;
+                set_flag(cpu, F_CF | F_OF, r > 0xFF);
+                return RMEMU_OK;
+            case 5:
+                r = (int8_t)ax * (int8_t)src;
+                cpu->reg[RMEMU_AX] = r;
+                set_flag(cpu, F_CF | F_OF, r != (int8_t)r);
+                return RMEMU_OK;
+            case 6:
+                if ((src & 0xFF) == 0 || ax / (src & 0xFF) > 0xFF) {
+                    return interrupt(cpu, 0);
+                }
+                cpu->reg[RMEMU_AX] = (ax % (src & 0xFF)) << 8 | ax / (src & 0xFF);
+                return RMEMU_OK;
+            default: {
+                int8_t d = src;
+                if (d == 0 || (int16_t)ax / d > 127 || (int16_t)ax / d < -128) {
+                    return interrupt(cpu, 0);
+                }
+                cpu->reg[RMEMU_AX] = ((uint8_t)((int16_t)ax % d)) << 8 | (uint8_t)((int16_t)ax / d);
+                return RMEMU_OK;
+            }
+        }
+    }
+
+    uint32_t dxax = (uint32_t)cpu->reg[RMEMU_DX] << 16 | cpu->reg[RMEMU_AX];
+    switch (op) {
+        case 4: {
+            uint32_t r = (uint32_t)cpu->reg[RMEMU_AX] * src;
+            cpu->reg[RMEMU_AX] = r;
+            cpu->reg[RMEMU_DX] = r >> 16;
+            set_flag(cpu, F_CF | F_OF, (r >> 16) != 0);
+            return RMEMU_OK;
+        }
+        case 5: {
+            int32_t r = (int32_t)(int16_t)cpu->reg[RMEMU_AX] * (int16_t)src;
+            cpu->reg[RMEMU_AX] = r;
+            cpu->reg[RMEMU_DX] = (uint32_t)r >> 16;
+            set_flag(cpu, F_CF | F_OF, r != (int16_t)r);
+            return RMEMU_OK;
+        }
+        case 6:
+            if (src == 0 || dxax / src > 0xFFFF) {
+                return interrupt(cpu, 0);
+            }
+            cpu->reg[RMEMU_AX] = dxax / src;
+            cpu->reg[RMEMU_DX] = dxax % src;
+            return RMEMU_OK;
+        default: {
+            int32_t n = (int32_t)dxax;
+            int16_t d = src;
+            if (d == 0 || n / d > 32767 || n / d < -32768) {
+                return interrupt(cpu, 0);
+            }
+            cpu->reg[RMEMU_AX] = n / d;
+            cpu->reg[RMEMU_DX] = n % d;
+            return RMEMU_OK;
+        }
+    }
+}
+
+// Строковые команды A4-AF, с префиксом повторения или без
+static void string_op(rmemu_t *cpu, const rmemu_insn_t *insn) {
+    int w = insn->op & 1;
+    int step = (cpu->flags & F_DF) ? -(1 + w) : 1 + w;
+    uint16_t src_seg = cpu->sreg[insn->seg >= 0 ? insn->seg : RMEMU_DS];
+    uint16_t es = cpu->sreg[RMEMU_ES];
+    int cmp = (insn->op & 0xFE) == 0xA6 || (insn->op & 0xFE) == 0xAE;
+
+    for (;;) {
+        if (insn->rep && cpu->reg[RMEMU_CX] == 0) {
+            break;
+        }
+        uint16_t si = cpu->reg[RMEMU_SI], di = cpu->reg[RMEMU_DI];
+        uint16_t a, b;
+        switch (insn->op & 0xFE) {
+            case 0xA4:
+                a = w ? rd16(cpu, src_seg, si) : rd8(cpu, src_seg, si);
+                if (w) {
+                    wr16(cpu, es, di, a);
+                } else {
+                    wr8(cpu, es, di, a);
+                }
+                cpu->reg[RMEMU_SI] += step;
+                cpu->reg[RMEMU_DI] += step;
+                break;
+            case 0xA6:
+                a = w ? rd16(cpu, src_seg, si) : rd8(cpu, src_seg, si);
+                b = w ? rd16(cpu, es, di) : rd8(cpu, es, di);
+                alu(cpu, 7, a, b, w);
+                cpu->reg[RMEMU_SI] += step;
+                cpu->reg[RMEMU_DI] += step;
+                break;
+            case 0xAA:
+                if (w) {
+                    wr16(cpu, es, di, cpu->reg[RMEMU_AX]);
+                } else {
+                    wr8(cpu, es, di, cpu->reg[RMEMU_AX]);
+                }
+                cpu->reg[RMEMU_DI] += step;
+                break;
+            case 0xAC:
+                set_reg(cpu, RMEMU_AX, w, w ? rd16(cpu, src_seg, si) : rd8(cpu, src_seg, si));
+                cpu->reg[RMEMU_SI] += step;
+                break;
+            default:
+                b = w ? rd16(cpu, es, di) : rd8(cpu, es, di);
+                alu(cpu, 7, get_reg(cpu, RMEMU_AX, w), b, w);
+                cpu->reg[RMEMU_DI] += step;
+                break;
+        }
+        if (!insn->rep) {
+            break;
+        }
+        cpu->reg[RMEMU_CX]--;
+        if (cmp && ((insn->rep == 0xF3) != ((cpu->flags & F_ZF) != 0))) {
+            break;
+        }
+    }
+}
+
+// Выполняет одну команду
+static int step(rmemu_t *cpu) {
+    uint8_t code[16];
+    rmemu_insn_t insn;
+
+    for (int i = 0; i < (int)sizeof(code); i++) {
+        code[i] = rd8(cpu, cpu->sreg[RMEMU_CS], cpu->ip + i);
+    }
+    if (rmemu_decode(code, sizeof(code), &insn) < 0) {
+        return RMEMU_ERR_OPCODE;
+    }
+    cpu->ip += insn.len;
+
+    uint8_t op = insn.op;
+    int w = op & 1;
+    uint16_t v;
+
+    if (op < 0x40 && (op & 7) < 6) {
+        int a = op >> 3;
+        switch (op & 7) {
+            case 0:
+            case 1:
+                v = alu(cpu, a, get_rm(cpu, &insn, w), get_reg(cpu, insn.reg, w), w);
+                if (a != 7) {
+                    set_rm(cpu, &insn, w, v);
+                }
+                break;
+            case 2:
+            case 3:
+                v = alu(cpu, a, get_reg(cpu, insn.reg, w), get_rm(cpu, &insn, w), w);
+                if (a != 7) {
+                    set_reg(cpu, insn.reg, w, v);
+                }
+                break;
+            default:
+                v = alu(cpu, a, get_reg(cpu, RMEMU_AX, w), insn.imm, w);
+                if (a != 7) {
+                    set_reg(cpu, RMEMU_AX, w, v);
+                }
+                break;
+        }
+        return RMEMU_OK;
+    }
+    if (op >= 0x40 && op < 0x50) {
+        cpu->reg[op & 7] = inc_dec(cpu, cpu->reg[op & 7], op >= 0x48, 1);
+        return RMEMU_OK;
+    }
+    if (op >= 0x50 && op < 0x58) {
+        // PUSH SP на 8086 кладёт уже уменьшенное значение
+        v = cpu->reg[op & 7];
+        push(cpu, (op & 7) == RMEMU_SP ? v - 2 : v);
+        return RMEMU_OK;
+    }
+    if (op >= 0x58 && op < 0x60) {
+        v = pop(cpu);
+        cpu->reg[op & 7] = v;
+        return RMEMU_OK;
+    }
+    if (op >= 0x70 && op < 0x80) {
+        if (condition(cpu, op & 0x0F)) {
+            cpu->ip += (int8_t)insn.imm;
+        }
+        return RMEMU_OK;
+    }
+    if (op >= 0x91 && op < 0x98) {
+        v = cpu->reg[RMEMU_AX];
+        cpu->reg[RMEMU_AX] = cpu->reg[op & 7];
+        cpu->reg[op & 7] = v;
+        return RMEMU_OK;
+    }
+    if (op >= 0xB0 && op < 0xC0) {
+        set_reg(cpu, op & 7, op >= 0xB8, insn.imm);
+        return RMEMU_OK;
+    }
+    if (op >= 0xA4 && op < 0xB0 && op != 0xA8 && op != 0xA9) {
+        string_op(cpu, &insn);
+        return RMEMU_OK;
+    }
+
+    switch (op) {
+        case 0x06: case 0x0E: case 0x16: case 0x1E:
+            push(cpu, cpu->sreg[op >> 3]);
+            return RMEMU_OK;
+        case 0x07: case 0x17: case 0x1F:
+            cpu->sreg[op >> 3] = pop(cpu);
+            return RMEMU_OK;
+        case 0x60: {
+            uint16_t sp = cpu->reg[RMEMU_SP];
+            for (int r = 0; r < 8; r++) {
+                push(cpu, r == RMEMU_SP ? sp : cpu->reg[r]);
+            }
+            return RMEMU_OK;
+        }
+        case 0x61:
+            for (int r = 7; r >= 0; r--) {
+                v = pop(cpu);
+                if (r != RMEMU_SP) {
+                    cpu->reg[r] = v;
+                }
+            }
+            return RMEMU_OK;
+        case 0x68:
+            push(cpu, insn.imm);
+            return RMEMU_OK;
+        case 0x6A:
+            push(cpu, (int8_t)insn.imm);
+            return RMEMU_OK;
+        case 0x80: case 0x81: case 0x82: case 0x83:
+            v = op == 0x83 ? (uint16_t)(int8_t)insn.imm : insn.imm;
+            w = op == 0x81 || op == 0x83;
+            v = alu(cpu, insn.reg, get_rm(cpu, &insn, w), v, w);
+            if (insn.reg != 7) {
+                set_rm(cpu, &insn, w, v);
+            }
+            return RMEMU_OK;
+        case 0x84: case 0x85:
+            alu(cpu, 4, get_rm(cpu, &insn, w), get_reg(cpu, insn.reg, w), w);
+            return RMEMU_OK;
+        case 0x86: case 0x87:
+            v = get_rm(cpu, &insn, w);
+            set_rm(cpu, &insn, w, get_reg(cpu, insn.reg, w));
+            set_reg(cpu, insn.reg, w, v);
+            return RMEMU_OK;
+        case 0x88: case 0x89:
+            set_rm(cpu, &insn, w, get_reg(cpu, insn.reg, w));
+            return RMEMU_OK;
+        case 0x8A: case 0x8B:
+            set_reg(cpu, insn.reg, w, get_rm(cpu, &insn, w));
+            return RMEMU_OK;
+        case 0x8C:
+            set_rm(cpu, &insn, 1, cpu->sreg[insn.reg & 3]);
+            return RMEMU_OK;
+        case 0x8D: {
+            uint16_t seg, off;
+            if (insn.mod == 3) {
+                return RMEMU_ERR_OPCODE;
+            }
+            modrm_addr(cpu, &insn, &seg, &off);
+            cpu->reg[insn.reg] = off;
+            return RMEMU_OK;
+        }
+        case 0x8E:
+            cpu->sreg[insn.reg & 3] = get_rm(cpu, &insn, 1);
+            return RMEMU_OK;
+        case 0x8F:
+            set_rm(cpu, &insn, 1, pop(cpu));
+            return RMEMU_OK;
+        case 0x90:
+        case 0x9B:
+        case 0xF0:
+            return RMEMU_OK;
+        case 0x98:
+            cpu->reg[RMEMU_AX] = (uint16_t)(int8_t)cpu->reg[RMEMU_AX];
+            return RMEMU_OK;
+        case 0x99:
+            cpu->reg[RMEMU_DX] = (cpu->reg[RMEMU_AX] & 0x8000) ? 0xFFFF : 0;
+            return RMEMU_OK;
+        case 0x9A:
+            push(cpu, cpu->sreg[RMEMU_CS]);
+            push(cpu, cpu->ip);
+            cpu->sreg[RMEMU_CS] = insn.imm2;
+            cpu->ip = insn.imm;
+            return RMEMU_OK;
+        case 0x9C:
+            push(cpu, cpu->flags | 0xF002);
+            return RMEMU_OK;
+        case 0x9D:
+            cpu->flags = pop(cpu);
+            return RMEMU_OK;
+        case 0x9E:
+            cpu->flags = (cpu->flags & 0xFF00) | (cpu->reg[RMEMU_AX] >> 8 & 0xD5);
+            return RMEMU_OK;
+        case 0x9F:
+            set_r8(cpu, 4, (cpu->flags & 0xD5) | 0x02);
+            return RMEMU_OK;
+        case 0xA0: case 0xA1: case 0xA2: case 0xA3: {
+            uint16_t seg = cpu->sreg[insn.seg >= 0 ? insn.seg : RMEMU_DS];
+            if (op < 0xA2) {
+                set_reg(cpu, RMEMU_AX, w, w ? rd16(cpu, seg, insn.disp) : rd8(cpu, seg, insn.disp));
+            } else if (w) {
+                wr16(cpu, seg, insn.disp, cpu->reg[RMEMU_AX]);
+            } else {
+                wr8(cpu, seg, insn.disp, cpu->reg[RMEMU_AX]);
+            }
+            return RMEMU_OK;
+        }
+        case 0xA8: case 0xA9:
+            alu(cpu, 4, get_reg(cpu, RMEMU_AX, w), insn.imm, w);
+            return RMEMU_OK;
+        case 0xC0: case 0xC1:
+            set_rm(cpu, &insn, w, shift(cpu, insn.reg, get_rm(cpu, &insn, w), insn.imm, w));
+            return RMEMU_OK;
+        case 0xD0: case 0xD1:
+            set_rm(cpu, &insn, w, shift(cpu, insn.reg, get_rm(cpu, &insn, w), 1, w));
+            return RMEMU_OK;
+        case 0xD2: case 0xD3:
+            set_rm(cpu, &insn, w, shift(cpu, insn.reg, get_rm(cpu, &insn, w),
+                                        cpu->reg[RMEMU_CX] & 0xFF, w));
+            return RMEMU_OK;
+        case 0xC2: case 0xC3:
+            cpu->ip = pop(cpu);
+            if (op == 0xC2) {
+                cpu->reg[RMEMU_SP] += insn.imm;
+            }
+            return RMEMU_OK;
+        case 0xC4: case 0xC5: {
+            uint16_t seg, off;
+            if (insn.mod == 3) {
+                return RMEMU_ERR_OPCODE;
+            }
+            modrm_addr(cpu, &insn, &seg, &off);
+            cpu->reg[insn.reg] = rd16(cpu, seg, off);
+            cpu->sreg[op == 0xC4 ? RMEMU_ES : RMEMU_DS] = rd16(cpu, seg, off + 2);
+            return RMEMU_OK;
+        }
+        case 0xC6: case 0xC7:
+            set_rm(cpu, &insn, w, insn.imm);
+            return RMEMU_OK;
+        case 0xC8: {
+            // ENTER только с нулевым уровнем вложенности
+            if (insn.imm2 != 0) {
+                return RMEMU_ERR_OPCODE;
+            }
+            push(cpu, cpu->reg[RMEMU_BP]);
+            cpu->reg[RMEMU_BP] = cpu->reg[RMEMU_SP];
+            cpu->reg[RMEMU_SP] -= insn.imm;
+            return RMEMU_OK;
+        }
+        case 0xC9:
+            cpu->reg[RMEMU_SP] = cpu->reg[RMEMU_BP];
+            cpu->reg[RMEMU_BP] = pop(cpu);
+            return RMEMU_OK;
+        case 0xCA: case 0xCB:
+            cpu->ip = pop(cpu);
+            cpu->sreg[RMEMU_CS] = pop(cpu);
+            if (op == 0xCA) {
+                cpu->reg[RMEMU_SP] += insn.imm;
+            }
+            return RMEMU_OK;
+        case 0xCC:
+            return interrupt(cpu, 3);
+        case 0xCD:
+            return interrupt(cpu, insn.imm);
+        case 0xCE:
+            return (cpu->flags & F_OF) ? interrupt(cpu, 4) : RMEMU_OK;
+        case 0xCF:
+            cpu->ip = pop(cpu);
+            cpu->sreg[RMEMU_CS] = pop(cpu);
+            cpu->flags = pop(cpu);
+            return RMEMU_OK;
+        case 0xD7: {
+            uint16_t seg = cpu->sreg[insn.seg >= 0 ? insn.seg : RMEMU_DS];
+            set_r8(cpu, 0, rd8(cpu, seg, cpu->reg[RMEMU_BX] + (cpu->reg[RMEMU_AX] & 0xFF)));
+            return RMEMU_OK;
+        }
+        case 0xE0: case 0xE1: case 0xE2:
+            cpu->reg[RMEMU_CX]--;
+            if (cpu->reg[RMEMU_CX] != 0 &&
+                (op == 0xE2 || (op == 0xE1) == ((cpu->flags & F_ZF) != 0))) {
+                cpu->ip += (int8_t)insn.imm;
+            }
+            return RMEMU_OK;
+        case 0xE3:
+            if (cpu->reg[RMEMU_CX] == 0) {
+                cpu->ip += (int8_t)insn.imm;
+            }
+            return RMEMU_OK;
+        case 0xE4: case 0xE5: case 0xEC: case 0xED:
+            set_reg(cpu, RMEMU_AX, w, 0xFFFF);
+            return RMEMU_OK;
+        case 0xE6: case 0xE7: case 0xEE: case 0xEF:
+            return RMEMU_OK;
+        case 0xE8:
+            push(cpu, cpu->ip);
+            cpu->ip += insn.imm;
+            return RMEMU_OK;
+        case 0xE9:
+            cpu->ip += insn.imm;
+            return RMEMU_OK;
+        case 0xEA:
+            cpu->sreg[RMEMU_CS] = insn.imm2;
+            cpu->ip = insn.imm;
+            return RMEMU_OK;
+        case 0xEB:
+            cpu->ip += (int8_t)insn.imm;
+            return RMEMU_OK;
+        case 0xF5:
+            cpu->flags ^= F_CF;
+            return RMEMU_OK;
+        case 0xF6: case 0xF7:
+            v = get_rm(cpu, &insn, w);
+            switch (insn.reg) {
+                case 0: case 1:
+                    alu(cpu, 4, v, insn.imm, w);
+                    return RMEMU_OK;
+                case 2:
+                    set_rm(cpu, &insn, w, ~v);
+                    return RMEMU_OK;
+                case 3:
+                    set_rm(cpu, &insn, w, alu(cpu, 5, 0, v, w));
+                    return RMEMU_OK;
+                default:
+                    return muldiv(cpu, insn.reg, v, w);
+            }
+        case 0xF8: case 0xF9:
+            set_flag(cpu, F_CF, op & 1);
+            return RMEMU_OK;
+        case 0xFA: case 0xFB:
+            set_flag(cpu, F_IF, op & 1);
+            return RMEMU_OK;
+        case 0xFC: case 0xFD:
+            set_flag(cpu, F_DF, op & 1);
+            return RMEMU_OK;
+        case 0xFE:
+            if (insn.reg > 1) {
+                return RMEMU_ERR_OPCODE;
+            }
+            set_rm(cpu, &insn, 0, inc_dec(cpu, get_rm(cpu, &insn, 0), insn.reg, 0));
+            return RMEMU_OK;
+        case 0xFF: {
+            uint16_t seg, off;
+            switch (insn.reg) {
+                case 0: case 1:
+                    set_rm(cpu, &insn, 1, inc_dec(cpu, get_rm(cpu, &insn, 1), insn.reg, 1));
+                    return RMEMU_OK;
+                case 2:
+                    v = get_rm(cpu, &insn, 1);
+                    push(cpu, cpu->ip);
+                    cpu->ip = v;
+                    return RMEMU_OK;
+                case 4:
+                    cpu->ip = get_rm(cpu, &insn, 1);
+                    return RMEMU_OK;
+                case 3: case 5:
+                    if (insn.mod == 3) {
+                        return RMEMU_ERR_OPCODE;
+                    }
+                    modrm_addr(cpu, &insn, &seg, &off);
+                    if (insn.reg == 3) {
+                        push(cpu, cpu->sreg[RMEMU_CS]);
+                        push(cpu, cpu->ip);
+                    }
+                    cpu->ip = rd16(cpu, seg, off);
+                    cpu->sreg[RMEMU_CS] = rd16(cpu, seg, off + 2);
+                    return RMEMU_OK;
+                case 6:
+                    push(cpu, get_rm(cpu, &insn, 1));
+                    return RMEMU_OK;
+                default:
+                    return RMEMU_ERR_OPCODE;
+            }
+        }
+        default:
+            // DAA, AAM, IMUL с операндом, ESC, HLT и другие
+            return RMEMU_ERR_OPCODE;
+    }
+}
+
+// Адрес возврата из вызываемого обработчика
+#define RET_SEG 0xF000
+#define RET_OFF 0xFFF0
+
+int rmemu_call_int(rmemu_t *cpu, uint16_t seg, uint16_t off, long max_steps) {
+    push(cpu, cpu->flags | 0xF002);
+    push(cpu, RET_SEG);
+    push(cpu, RET_OFF);
+    cpu->sreg[RMEMU_CS] = seg;
+    cpu->ip = off;
+    cpu->steps = 0;
+    while (cpu->sreg[RMEMU_CS] != RET_SEG || cpu->ip != RET_OFF) {
+        if (cpu->steps++ >= max_steps) {
+            return RMEMU_ERR_STEPS;
+        }
+        int err = step(cpu);
+        if (err != RMEMU_OK) {
+            return err;
+        }
+    }
+    return RMEMU_OK;
+}
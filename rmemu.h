@@ -0,0 +1,61 @@
+#ifndef ___RMEMU_H___
+#define ___RMEMU_H___
+
+#include <stdint.h>
+
+// Небольшой эмулятор 16-битного реального режима x86 (8086 и команды
+// 80186) для выполнения отдельных функций ROM BIOS видеокарты на образе
+// в памяти. ROM отображается с адреса C000:0000, остальная память -
+// нули, кроме нескольких полей области данных BIOS. Порты ввода-вывода
+// читаются как 0xFF, запись в них пропускается. Прерывание с пустым
+// вектором и команды, которых нет в эмуляторе, останавливают выполнение.
+
+#define RMEMU_OK             0
+#define RMEMU_ERR_NOMEM     -1      // не хватило памяти
+#define RMEMU_ERR_OPCODE    -2      // команда не поддерживается
+#define RMEMU_ERR_STEPS     -3      // превышено число шагов
+#define RMEMU_ERR_INT       -4      // прерывание с пустым вектором
+
+#define RMEMU_ROM_SEG   0xC000
+#define RMEMU_MAX_ROM   0x20000
+
+// Регистры в порядке их кодов в команде
+enum { RMEMU_AX, RMEMU_CX, RMEMU_DX, RMEMU_BX, RMEMU_SP, RMEMU_BP, RMEMU_SI, RMEMU_DI };
+enum { RMEMU_ES, RMEMU_CS, RMEMU_SS, RMEMU_DS };
+
+typedef struct {
+    uint16_t reg[8];
+    uint16_t sreg[4];
+    uint16_t ip;
+    uint16_t flags;
+    uint8_t *mem;           // 1 МБ
+    long steps;
+} rmemu_t;
+
+// Декодированная команда
+typedef struct {
+    int len;
+    int seg;                // префикс сегмента RMEMU_ES..RMEMU_DS, -1 - нет
+    int rep;                // префикс 0xF2 или 0xF3, 0 - нет
+    uint8_t op;
+    int has_modrm;
+    uint8_t mod, reg, rm;
+    uint16_t disp;
+    uint16_t imm;
+    uint16_t imm2;          // сегмент дальнего адреса (9A, EA)
+} rmemu_insn_t;
+
+// Декодирует команду по адресу code (avail байт доступно). Возвращает
+// длину или RMEMU_ERR_OPCODE для неизвестной или обрезанной команды.
+int rmemu_decode(const uint8_t *code, int avail, rmemu_insn_t *insn);
+
+// Создаёт машину с образом ROM (линейный порядок, до RMEMU_MAX_ROM байт)
+int rmemu_init(rmemu_t *cpu, const uint8_t *rom, int size);
+void rmemu_free(rmemu_t *cpu);
+
+// Вызывает обработчик прерывания по адресу seg:off как команда INT и
+// выполняет его до возврата (IRET), но не больше max_steps команд.
+// Регистры задаются до вызова и читаются после.
+int rmemu_call_int(rmemu_t *cpu, uint16_t seg, uint16_t off, long max_steps);
+
+#endif // ___RMEMU_H___
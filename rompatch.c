@@ -0,0 +1,468 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rompatch.h"
+
+#define IPS_MAX_OFFSET  0xFFFFFF
+#define IPS_MAX_RECORD  0xFFFF
+#define IPS_EOF         0x454F46    // адрес, совпадающий с "EOF"
+
+// Разрыв между отличающимися байтами, при котором выгоднее начать
+// новую запись, чем переписать неизменённые байты
+#define IPS_MERGE_GAP   5
+#define BPS_MERGE_GAP   2
+
+enum { BPS_SOURCE_READ, BPS_TARGET_READ, BPS_SOURCE_COPY, BPS_TARGET_COPY };
+
+// Растущий буфер патча
+typedef struct {
+    uint8_t *data;
+    int len;
+    int cap;
+    int failed;
+} buf_t;
+
+static void put_bytes(buf_t *b, const void *data, int len) {
+    if (b->failed) {
+        return;
+    }
+    if (b->len + len > b->cap) {
+        int cap = b->cap ? b->cap : 256;
+        while (cap < b->len + len) {
+            cap *= 2;
+        }
+        uint8_t *p = realloc(b->data, cap);
+        if (!p) {
+            b->failed = 1;
+            return;
+        }
+        b->data = p;
+        b->cap = cap;
+    }
+    memcpy(b->data + b->len, data, len);
+    b->len += len;
+}
+
+static void put_byte(buf_t *b, uint8_t v) {
+    put_bytes(b, &v, 1);
+}
+
+static void put_be(buf_t *b, uint32_t v, int bytes) {
+    while (bytes-- > 0) {
+        put_byte(b, (uint8_t)(v >> (8 * bytes)));
+    }
+}
+
+static void put_le32(buf_t *b, uint32_t v) {
+    for (int i = 0; i < 4; i++) {
+        put_byte(b, (uint8_t)(v >> (8 * i)));
+    }
+}
+
+// Число в BPS: по 7 бит, старший бит отмечает последний байт
+static void put_varint(buf_t *b, uint64_t v) {
+    for (;;) {
+        uint8_t x = v & 0x7F;
+        v >>= 7;
+        if (v == 0) {
+            put_byte(b, 0x80 | x);
+            return;
+        }
+        put_byte(b, x);
+        v--;
+    }
+}
+
+static uint32_t crc_table[256];
+static pthread_once_t crc_once = PTHREAD_ONCE_INIT;
+
+static void crc_init(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+        }
+        crc_table[i] = c;
+    }
+}
+
+static uint32_t crc32(const uint8_t *data, int len) {
+    pthread_once(&crc_once, crc_init);
+
+    uint32_t crc = 0xFFFFFFFF;
+    for (int i = 0; i < len; i++) {
+        crc = crc_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+// Участки отличающихся байт внутри ranges. Участки, между которыми
+// меньше gap одинаковых байт, сливаются. Возвращает их число.
+static int diff_runs(const uint8_t *src, const uint8_t *dst,
+                     const vgarom_range_t *ranges, int nranges, int gap,
+                     vgarom_range_t *runs) {
+    int n = 0;
+    for (int i = 0; i < nranges; i++) {
+        int end = ranges[i].offset + ranges[i].len;
+        for (int pos = ranges[i].offset; pos < end; pos++) {
+            if (src[pos] == dst[pos]) {
+                continue;
+            }
+            if (n > 0 && pos - (runs[n - 1].offset + runs[n - 1].len) <= gap) {
+                runs[n - 1].len = pos + 1 - runs[n - 1].offset;
+            } else {
+                runs[n].offset = pos;
+                runs[n].len = 1;
+                n++;
+            }
+        }
+    }
+    return n;
+}
+
+static int build_ips(buf_t *b, const uint8_t *dst, int size,
+                     vgarom_range_t *runs, int nruns) {
+    if (size - 1 > IPS_MAX_OFFSET) {
+        return ROMPATCH_ERR_RANGE;
+    }
+    put_bytes(b, "PATCH", 5);
+    for (int i = 0; i < nruns; i++) {
+        int offset = runs[i].offset;
+        int end = offset + runs[i].len;
+        while (offset < end) {
+            // Запись с адреса 0x454F46 читалась бы как конец патча
+            if (offset == IPS_EOF) {
+                offset--;
+            }
+            int len = end - offset > IPS_MAX_RECORD ? IPS_MAX_RECORD : end - offset;
+            put_be(b, offset, 3);
+            put_be(b, len, 2);
+            put_bytes(b, dst + offset, len);
+            offset += len;
+        }
+    }
+    put_bytes(b, "EOF", 3);
+    return ROMPATCH_OK;
+}
+
+static int build_bps(buf_t *b, const uint8_t *src, const uint8_t *dst, int size,
+                     const vgarom_range_t *runs, int nruns) {
+    int pos = 0;
+
+    put_bytes(b, "BPS1", 4);
+    put_varint(b, size);
+    put_varint(b, size);
+    put_varint(b, 0);
+    for (int i = 0; i <= nruns; i++) {
+        int start = (i < nruns) ? runs[i].offset : size;
+        // Неизменённые байты берутся из исходного образа по тому же адресу
+        if (start > pos) {
+            put_varint(b, (uint64_t)(start - pos - 1) << 2 | BPS_SOURCE_READ);
+        }
+        if (i < nruns) {
+            put_varint(b, (uint64_t)(runs[i].len - 1) << 2 | BPS_TARGET_READ);
+            put_bytes(b, dst + runs[i].offset, runs[i].len);
+            pos = runs[i].offset + runs[i].len;
+        }
+    }
+    put_le32(b, crc32(src, size));
+    put_le32(b, crc32(dst, size));
+    if (!b->failed) {
+        put_le32(b, crc32(b->data, b->len));
+    }
+    return ROMPATCH_OK;
+}
+
+int rompatch_build(int format, const uint8_t *src, const uint8_t *dst, int size,
+                   const vgarom_range_t *ranges, int nranges,
+                   uint8_t **patch, int *patch_size) {
+    buf_t b = { NULL, 0, 0, 0 };
+    int err = ROMPATCH_ERR_FORMAT;
+
+    *patch = NULL;
+    *patch_size = 0;
+
+    // Участков не больше, чем изменённых байт в областях
+    long total = 0;
+    for (int i = 0; i < nranges; i++) {
+        total += ranges[i].len;
+    }
+    vgarom_range_t *runs = malloc((total + 1) * sizeof(*runs));
+    if (!runs) {
+        return ROMPATCH_ERR_NOMEM;
+    }
+
+    if (format == ROMPATCH_IPS) {
+        int nruns = diff_runs(src, dst, ranges, nranges, IPS_MERGE_GAP, runs);
+        err = build_ips(&b, dst, size, runs, nruns);
+    } else if (format == ROMPATCH_BPS) {
+        int nruns = diff_runs(src, dst, ranges, nranges, BPS_MERGE_GAP, runs);
+        err = build_bps(&b, src, dst, size, runs, nruns);
+    }
+    free(runs);
+
+    if (err == ROMPATCH_OK && b.failed) {
+        err = ROMPATCH_ERR_NOMEM;
+    }
+    if (err != ROMPATCH_OK) {
+        free(b.data);
+        return err;
+    }
+    *patch = b.data;
+    *patch_size = b.len;
+    return ROMPATCH_OK;
+}
+
+static int apply_ips(const uint8_t *patch, int patch_size,
+                     const uint8_t *src, int src_size,
+                     uint8_t **dst, int *dst_size) {
+    int pos = 5;
+    int size = src_size;
+    int cap = src_size > 0 ? src_size : 1;
+    uint8_t *out = malloc(cap);
+    if (!out) {
+        return ROMPATCH_ERR_NOMEM;
+    }
+    memcpy(out, src, src_size);
+
+    for (;;) {
+        if (pos + 3 > patch_size) {
+            free(out);
+            return ROMPATCH_ERR_FORMAT;
+        }
+        int offset = patch[pos] << 16 | patch[pos + 1] << 8 | patch[pos + 2];
+        pos += 3;
+        if (offset == IPS_EOF) {
+            break;
+        }
+
+        // Запись с длиной 0 - серия одинаковых байт (RLE)
+        if (pos + 2 > patch_size) {
+            free(out);
+            return ROMPATCH_ERR_FORMAT;
+        }
+        int len = patch[pos] << 8 | patch[pos + 1];
+        pos += 2;
+        int rle = (len == 0);
+        if (rle) {
+            if (pos + 3 > patch_size) {
+                free(out);
+                return ROMPATCH_ERR_FORMAT;
+            }
+            len = patch[pos] << 8 | patch[pos + 1];
+            pos += 2;
+        } else if (pos + len > patch_size) {
+            free(out);
+            return ROMPATCH_ERR_FORMAT;
+        }
+
+        // Запись за концом образа увеличивает его
+        if (offset + len > cap) {
+            int new_cap = cap;
+            while (new_cap < offset + len) {
+                new_cap *= 2;
+            }
+            uint8_t *p = realloc(out, new_cap);
+            if (!p) {
+                free(out);
+                return ROMPATCH_ERR_NOMEM;
+            }
+            out = p;
+            cap = new_cap;
+        }
+        if (offset > size) {
+            memset(out + size, 0, offset - size);
+        }
+        if (rle) {
+            memset(out + offset, patch[pos], len);
+            pos++;
+        } else {
+            memcpy(out + offset, patch + pos, len);
+            pos += len;
+        }
+        if (offset + len > size) {
+            size = offset + len;
+        }
+    }
+
+    // Необязательное расширение: после EOF - новая длина образа
+    if (pos + 3 <= patch_size) {
+        int truncate = patch[pos] << 16 | patch[pos + 1] << 8 | patch[pos + 2];
+        if (truncate < size) {
+            size = truncate;
+        }
+    }
+    *dst = out;
+    *dst_size = size;
+    return ROMPATCH_OK;
+}
+
+// Читает число BPS, -1 - патч кончился раньше
+static int64_t get_varint(const uint8_t *patch, int end, int *pos) {
+    uint64_t data = 0, shift = 1;
+    for (int i = 0; i < 10; i++) {
+        if (*pos >= end) {
+            return -1;
+        }
+        uint8_t x = patch[(*pos)++];
+        data += (x & 0x7F) * shift;
+        if (x & 0x80) {
+            return data > INT32_MAX ? -1 : (int64_t)data;
+        }
+        shift <<= 7;
+        data += shift;
+    }
+    return -1;
+}
+
+static uint32_t get_le32(const uint8_t *p) {
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static int apply_bps(const uint8_t *patch, int patch_size,
+                     const uint8_t *src, int src_size,
+                     uint8_t **dst, int *dst_size) {
+    if (patch_size < 4 + 3 + 12) {
+        return ROMPATCH_ERR_FORMAT;
+    }
+    const int end = patch_size - 12;
+    if (crc32(patch, patch_size - 4) != get_le32(patch + patch_size - 4)) {
+        return ROMPATCH_ERR_CRC;
+    }
+
+    int pos = 4;
+    int64_t source_size = get_varint(patch, end, &pos);
+    int64_t target_size = get_varint(patch, end, &pos);
+    int64_t meta_size = get_varint(patch, end, &pos);
+    if (source_size < 0 || target_size < 0 || meta_size < 0 || meta_size > end - pos) {
+        return ROMPATCH_ERR_FORMAT;
+    }
+    pos += meta_size;
+    if (source_size != src_size || crc32(src, src_size) != get_le32(patch + end)) {
+        return ROMPATCH_ERR_SOURCE;
+    }
+
+    uint8_t *out = malloc(target_size > 0 ? target_size : 1);
+    if (!out) {
+        return ROMPATCH_ERR_NOMEM;
+    }
+    int64_t out_pos = 0, source_rel = 0, target_rel = 0;
+    int err = ROMPATCH_OK;
+    while (pos < end && err == ROMPATCH_OK) {
+        int64_t action = get_varint(patch, end, &pos);
+        if (action < 0) {
+            err = ROMPATCH_ERR_FORMAT;
+            break;
+        }
+        int64_t len = (action >> 2) + 1;
+        if (out_pos + len > target_size) {
+            err = ROMPATCH_ERR_FORMAT;
+            break;
+        }
+        switch (action & 3) {
+            case BPS_SOURCE_READ:
+                if (out_pos + len > src_size) {
+                    err = ROMPATCH_ERR_FORMAT;
+                    break;
+                }
+                memcpy(out + out_pos, src + out_pos, len);
+                break;
+            case BPS_TARGET_READ:
+                if (pos + len > end) {
+                    err = ROMPATCH_ERR_FORMAT;
+                    break;
+                }
+                memcpy(out + out_pos, patch + pos, len);
+                pos += len;
+                break;
+            case BPS_SOURCE_COPY:
+            case BPS_TARGET_COPY: {
+                // Смещение - знаковое число, младший бит - знак
+                int64_t v = get_varint(patch, end, &pos);
+                if (v < 0) {
+                    err = ROMPATCH_ERR_FORMAT;
+                    break;
+                }
+                int64_t delta = (v & 1) ? -(v >> 1) : (v >> 1);
+                if ((action & 3) == BPS_SOURCE_COPY) {
+                    source_rel += delta;
+                    if (source_rel < 0 || source_rel + len > src_size) {
+                        err = ROMPATCH_ERR_FORMAT;
+                        break;
+                    }
+                    memcpy(out + out_pos, src + source_rel, len);
+                    source_rel += len;
+                } else {
+                    target_rel += delta;
+                    if (target_rel < 0 || target_rel >= out_pos) {
+                        err = ROMPATCH_ERR_FORMAT;
+                        break;
+                    }
+                    // Копия может перекрываться с записываемым, побайтно
+                    for (int64_t i = 0; i < len; i++) {
+                        out[out_pos + i] = out[target_rel++];
+                    }
+                }
+                break;
+            }
+        }
+        out_pos += len;
+    }
+
+    if (err == ROMPATCH_OK && out_pos != target_size) {
+        err = ROMPATCH_ERR_FORMAT;
+    }
+    if (err == ROMPATCH_OK && crc32(out, target_size) != get_le32(patch + end + 4)) {
+        err = ROMPATCH_ERR_CRC;
+    }
+    if (err != ROMPATCH_OK) {
+        free(out);
+        return err;
+    }
+    *dst = out;
+    *dst_size = target_size;
+    return ROMPATCH_OK;
+}
+
+int rompatch_apply(const uint8_t *patch, int patch_size,
+                   const uint8_t *src, int src_size,
+                   uint8_t **dst, int *dst_size) {
+    *dst = NULL;
+    *dst_size = 0;
+    if (patch_size >= 8 && memcmp(patch, "PATCH", 5) == 0) {
+        return apply_ips(patch, patch_size, src, src_size, dst, dst_size);
+    }
+    if (patch_size >= 4 && memcmp(patch, "BPS1", 4) == 0) {
+        return apply_bps(patch, patch_size, src, src_size, dst, dst_size);
+    }
+    return ROMPATCH_ERR_FORMAT;
+}
+
+int rompatch_format(const char *name) {
+    if (strcmp(name, "ips") == 0) {
+        return ROMPATCH_IPS;
+    }
+    if (strcmp(name, "bps") == 0) {
+        return ROMPATCH_BPS;
+    }
+    return ROMPATCH_NONE;
+}
+
+const char *rompatch_strerror(int err) {
+    switch (err) {
+        case ROMPATCH_OK:
+            return "Success";
+        case ROMPATCH_ERR_NOMEM:
+            return "Memory allocation failed";
+        case ROMPATCH_ERR_FORMAT:
+            return "Not a valid IPS or BPS patch";
+        case ROMPATCH_ERR_SOURCE:
+            return "The patch was made for a different ROM image";
+        case ROMPATCH_ERR_CRC:
+            return "Patch or result checksum mismatch";
+        case ROMPATCH_ERR_RANGE:
+            return "Image is too large for an IPS patch";
+        default:
+            return "Unknown error";
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef ___ROMPATCH_H___
+#define ___ROMPATCH_H___
+
+#include <stdint.h>
+#include "vgarom.h"
+
+// Бинарные патчи образов в форматах IPS и BPS. Патч строится по
+// списку изменённых областей (vgarom_changes), так что образы не
+// сравниваются целиком. IPS - записи "адрес, длина, данные" без
+// контрольных сумм; BPS хранит CRC32 исходного образа, результата
+// и самого патча, и чужой или повреждённый патч не применяется.
+
+#define ROMPATCH_OK            0
+#define ROMPATCH_ERR_NOMEM    -1    // не хватило памяти
+#define ROMPATCH_ERR_FORMAT   -2    // не IPS/BPS или патч повреждён
+#define ROMPATCH_ERR_SOURCE   -3    // патч сделан для другого образа
+#define ROMPATCH_ERR_CRC      -4    // не совпала CRC патча или результата
+#define ROMPATCH_ERR_RANGE    -5    // образ слишком велик для IPS
+
+// Форматы патчей
+enum {
+    ROMPATCH_NONE,
+    ROMPATCH_IPS,
+    ROMPATCH_BPS
+};
+
+// Строит патч из src в dst (оба size байт), отличающихся только внутри
+// ranges. Патч выделяется функцией и освобождается вызывающим.
+int rompatch_build(int format, const uint8_t *src, const uint8_t *dst, int size,
+                   const vgarom_range_t *ranges, int nranges,
+                   uint8_t **patch, int *patch_size);
+
+// Применяет патч IPS или BPS (формат определяется по сигнатуре) к src.
+// Результат выделяется функцией и освобождается вызывающим.
+int rompatch_apply(const uint8_t *patch, int patch_size,
+                   const uint8_t *src, int src_size,
+                   uint8_t **dst, int *dst_size);
+
+// Формат по имени ("ips", "bps"), ROMPATCH_NONE - неизвестное имя
+int rompatch_format(const char *name);
+
+// Описание кода ошибки
+const char *rompatch_strerror(int err);
+
+#endif // ___ROMPATCH_H___
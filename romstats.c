@@ -0,0 +1,116 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "romstats.h"
+
+static const char *const phase_names[ROMSTATS_PHASES] = {
+    "load", "deinterleave", "detect", "patterns", "fonts", "checksum", "write"
+};
+
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static FILE *stats_file = NULL;
+
+static long elapsed_ns(const struct timespec *from, const struct timespec *to) {
+    return (to->tv_sec - from->tv_sec) * 1000000000L + (to->tv_nsec - from->tv_nsec);
+}
+
+int romstats_open(const char *path) {
+    if (strcmp(path, "-") == 0) {
+        // Стандартный вывод остаётся только для строк JSON, а сообщения
+        // программы (printf) переводятся в stderr, чтобы не портить поток
+        int fd = dup(STDOUT_FILENO);
+        stats_file = fd >= 0 ? fdopen(fd, "w") : NULL;
+        if (!stats_file) {
+            perror("Error opening stats file");
+            if (fd >= 0) {
+                close(fd);
+            }
+            return -1;
+        }
+        fflush(stdout);
+        dup2(STDERR_FILENO, STDOUT_FILENO);
+        return 0;
+    }
+    stats_file = fopen(path, "a");
+    if (!stats_file) {
+        perror("Error opening stats file");
+        return -1;
+    }
+    return 0;
+}
+
+void romstats_close(void) {
+    if (stats_file) {
+        fclose(stats_file);
+    }
+    stats_file = NULL;
+}
+
+void romstats_begin(romstats_t *st, const char *input, const char *output) {
+    memset(st, 0, sizeof(*st));
+    st->input = input;
+    st->output = output;
+    st->status = "failed";
+    clock_gettime(CLOCK_MONOTONIC, &st->start);
+    st->last = st->start;
+}
+
+void romstats_mark(romstats_t *st, int phase) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    st->ns[phase] += elapsed_ns(&st->last, &now);
+    st->last = now;
+}
+
+// Строка JSON: кавычки, обратная косая черта и управляющие символы
+// экранируются
+static void write_string(FILE *f, const char *s) {
+    if (!s) {
+        fputs("null", f);
+        return;
+    }
+    fputc('"', f);
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            fprintf(f, "\\%c", c);
+        } else if (c < 0x20) {
+            fprintf(f, "\\u%04x", c);
+        } else {
+            fputc(c, f);
+        }
+    }
+    fputc('"', f);
+}
+
+void romstats_write(romstats_t *st) {
+    struct timespec now;
+
+    if (!stats_file) {
+        return;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    // Строка пишется целиком под блокировкой, чтобы записи потоков
+    // пакетного режима не перемешивались
+    pthread_mutex_lock(&stats_lock);
+    FILE *f = stats_file;
+    fputs("{\"input\":", f);
+    write_string(f, st->input);
+    fputs(",\"output\":", f);
+    write_string(f, st->output);
+    fprintf(f, ",\"size\":%d,\"status\":\"%s\",\"time_ns\":{", st->size, st->status);
+    for (int i = 0; i < ROMSTATS_PHASES; i++) {
+        fprintf(f, "\"%s\":%ld,", phase_names[i], st->ns[i]);
+    }
+    fprintf(f, "\"total\":%ld},\"counters\":{", elapsed_ns(&st->start, &now));
+    fprintf(f, "\"bytes_scanned\":%ld,\"glyph_compares\":%ld,\"candidates\":%ld,",
+            st->bytes_scanned, st->glyph_compares, st->candidates);
+    fprintf(f, "\"pattern_replacements\":%ld,\"fuzzy_hits\":%ld,",
+            st->pattern_replacements, st->fuzzy_hits);
+    fprintf(f, "\"fonts_replaced\":%ld,\"allocations\":%ld}}\n",
+            st->fonts_replaced, st->allocations);
+    fflush(f);
+    pthread_mutex_unlock(&stats_lock);
+}
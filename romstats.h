@@ -0,0 +1,59 @@
+#ifndef ___ROMSTATS_H___
+#define ___ROMSTATS_H___
+
+#include <time.h>
+
+// Статистика обработки ROM для внешних систем мониторинга. На каждый
+// образ в файл статистики пишется одна строка JSON со временем фаз
+// (монотонные часы, наносекунды) и счётчиками:
+//   {"input":"card.bin","output":"card_rus.bin","size":32768,"status":"ok",
+//    "time_ns":{"load":...,"deinterleave":...,"detect":...,"patterns":...,
+//               "fonts":...,"checksum":...,"write":...,"total":...},
+//    "counters":{"bytes_scanned":...,"glyph_compares":...,"candidates":...,
+//                "pattern_replacements":...,"fuzzy_hits":...,
+//                "fonts_replaced":...,"allocations":...}}
+// Запись строк можно вызывать из нескольких потоков.
+
+enum {
+    ROMSTATS_LOAD,          // открытие входа и проверка заголовка
+    ROMSTATS_DEINTERLEAVE,  // первый проход: порядок байт, сумма, якоря
+    ROMSTATS_DETECT,        // поиск таблиц шрифтов или взятие из индекса
+    ROMSTATS_PATTERNS,      // паттерны DOS-шрифта
+    ROMSTATS_FONTS,         // замена таблиц шрифтов
+    ROMSTATS_CHECKSUM,
+    ROMSTATS_WRITE,         // выходной файл, перемешивание, кэш результатов
+    ROMSTATS_PHASES
+};
+
+typedef struct {
+    const char *input;      // NULL - образ пришёл не из файла
+    const char *output;
+    int size;
+    const char *status;     // "ok", "cached" или "failed"
+    struct timespec start;
+    struct timespec last;
+    long ns[ROMSTATS_PHASES];
+    long bytes_scanned;
+    long glyph_compares;
+    long candidates;
+    long pattern_replacements;
+    long fuzzy_hits;        // из них нечётких (--fuzzy)
+    long fonts_replaced;
+    long allocations;
+} romstats_t;
+
+// Открывает файл статистики для дозаписи. "-" - стандартный вывод:
+// тогда он отдаётся только статистике, а остальной вывод идёт в stderr
+int romstats_open(const char *path);
+void romstats_close(void);
+
+// Начинает отсчёт для одного образа
+void romstats_begin(romstats_t *st, const char *input, const char *output);
+
+// Относит время с предыдущей отметки к фазе phase
+void romstats_mark(romstats_t *st, int phase);
+
+// Записывает строку образа, если файл статистики открыт
+void romstats_write(romstats_t *st);
+
+#endif // ___ROMSTATS_H___
@@ -0,0 +1,183 @@
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "serve.h"
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void on_stop_signal(int sig) {
+    (void)sig;
+    stop_requested = 1;
+}
+
+static int write_full(int fd, const void *buf, size_t len) {
+    const uint8_t *p = buf;
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR && !stop_requested) continue;
+            return -1;
+        }
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+// Возвращает 0, 1 при закрытом соединении или -1 при ошибке
+static int read_full(int fd, void *buf, size_t len) {
+    uint8_t *p = buf;
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR && !stop_requested) continue;
+            return -1;
+        }
+        if (n == 0) {
+            return p == buf ? 1 : -1;
+        }
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+// Читает заголовок запроса побайтно, чтобы не захватить начало образа.
+// Возвращает длину строки, 0 при закрытом соединении или -1.
+static int read_header(int fd, char *line, int max) {
+    int len = 0;
+    for (;;) {
+        char c;
+        int rc = read_full(fd, &c, 1);
+        if (rc != 0) {
+            return (rc == 1 && len == 0) ? 0 : -1;
+        }
+        if (c == '\n') {
+            line[len] = '\0';
+            return len;
+        }
+        if (len == max - 1) {
+            return -1;
+        }
+        line[len++] = c;
+    }
+}
+
+static void send_error(int fd, const char *msg) {
+    char line[320];
+    int n = snprintf(line, sizeof(line), "ERR %s\n", msg);
+    write_full(fd, line, n);
+}
+
+// Обслуживает одно соединение до его закрытия
+static void serve_client(int fd, serve_fn fn, void *ctx, uint8_t *rom) {
+    char header[SERVE_MAX_HEADER];
+
+    while (!stop_requested) {
+        int len = read_header(fd, header, sizeof(header));
+        if (len <= 0) {
+            if (len < 0) send_error(fd, "Bad request header");
+            return;
+        }
+
+        char *args;
+        long size = strtol(header, &args, 10);
+        if (args == header || size < 2 || size > SERVE_MAX_ROM) {
+            send_error(fd, "Bad ROM size");
+            return;
+        }
+        if (read_full(fd, rom, size) != 0) {
+            return;
+        }
+
+        serve_request_t req = { .args = args, .rom = rom, .size = (int)size };
+        if (fn(&req, ctx) != 0) {
+            send_error(fd, req.error[0] ? req.error : "Processing failed");
+            continue;
+        }
+
+        char line[32];
+        int n = snprintf(line, sizeof(line), "OK %d\n", req.size);
+        if (write_full(fd, line, n) != 0 || write_full(fd, req.result, req.size) != 0) {
+            return;
+        }
+    }
+}
+
+int serve_run(const char *socket_path, serve_fn fn, void *ctx) {
+    struct sockaddr_un addr;
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Error: Socket path is too long\n");
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socket_path);
+
+    uint8_t *rom = malloc(SERVE_MAX_ROM);
+    if (!rom) {
+        perror("Memory allocation failed");
+        return -1;
+    }
+
+    int lfd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (lfd == -1) {
+        perror("Error creating socket");
+        free(rom);
+        return -1;
+    }
+    // Удаляется только сокет, оставшийся от прежнего запуска: файл
+    // с тем же именем может оказаться чем угодно
+    struct stat st;
+    if (lstat(socket_path, &st) == 0) {
+        if (!S_ISSOCK(st.st_mode)) {
+            fprintf(stderr, "Error: %s exists and is not a socket\n", socket_path);
+            close(lfd);
+            free(rom);
+            return -1;
+        }
+        unlink(socket_path);
+    }
+    if (bind(lfd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(lfd, 16) != 0 ||
+        lstat(socket_path, &st) != 0) {
+        perror("Error binding socket");
+        close(lfd);
+        free(rom);
+        return -1;
+    }
+    // Сокет этого процесса, только его удаляем при выходе
+    const dev_t sock_dev = st.st_dev;
+    const ino_t sock_ino = st.st_ino;
+
+    // Без SA_RESTART, чтобы сигнал прерывал accept и read
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_stop_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    while (!stop_requested) {
+        int fd = accept(lfd, NULL, NULL);
+        if (fd == -1) {
+            if (errno != EINTR) perror("Error accepting connection");
+            continue;
+        }
+        serve_client(fd, fn, ctx, rom);
+        close(fd);
+    }
+
+    close(lfd);
+    if (lstat(socket_path, &st) == 0 && S_ISSOCK(st.st_mode) &&
+        st.st_dev == sock_dev && st.st_ino == sock_ino) {
+        unlink(socket_path);
+    }
+    free(rom);
+    return 0;
+}
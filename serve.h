@@ -0,0 +1,35 @@
+#ifndef ___SERVE_H___
+#define ___SERVE_H___
+
+#include <stdint.h>
+
+// Протокол сервера fontupdate (Unix-сокет, несколько запросов подряд
+// в одном соединении):
+//   запрос: строка "<размер> [параметры]\n", затем образ ROM;
+//           параметры - как в строке манифеста, без -i и -o
+//   ответ:  "OK <размер>\n" и обработанный образ
+//           или "ERR <сообщение>\n"
+#define SERVE_MAX_HEADER   4096
+#define SERVE_MAX_ROM      (1 << 20)
+
+// Один запрос. Обработчик кладёт в result указатель на готовый образ
+// (size байт), который должен жить до следующего вызова, или текст
+// ошибки в error.
+typedef struct {
+    char *args;
+    uint8_t *rom;
+    int size;
+    const uint8_t *result;
+    char error[256];
+} serve_request_t;
+
+// Возвращает 0 или -1 при ошибке (ответ ERR)
+typedef int (*serve_fn)(serve_request_t *req, void *ctx);
+
+// Принимает соединения на socket_path и обслуживает их по очереди,
+// пока не придёт SIGINT или SIGTERM. Существующий файл socket_path
+// заменяется, только если это сокет; при выходе удаляется свой сокет.
+// Возвращает 0 или -1, если сокет не удалось открыть.
+int serve_run(const char *socket_path, serve_fn fn, void *ctx);
+
+#endif // ___SERVE_H___
@@ -2,10 +2,11 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include "../fontlib.h"
 
 // Функция для отображения символа DOS-шрифта в консоли
-void display_char(uint8_t *char_data) {
-    for (int y = 0; y < 16; y++) {
+void display_char(const uint8_t *char_data, int height) {
+    for (int y = 0; y < height; y++) {
         for (int x = 0; x < 8; x++) {
             if (char_data[y] & (0x80 >> x)) {
                 printf("\u2588"); // Полный блок Unicode
@@ -18,14 +19,14 @@ void display_char(uint8_t *char_data) {
 }
 
 // Функция для сохранения символа в текстовый файл как ASCII-арт
-void save_char_as_text(uint8_t *char_data, const char *filename) {
+void save_char_as_text(const uint8_t *char_data, int height, const char *filename) {
     FILE *f = fopen(filename, "w");
     if (!f) {
         perror("Не удалось создать файл");
         return;
     }
 
-    for (int y = 0; y < 16; y++) {
+    for (int y = 0; y < height; y++) {
         for (int x = 0; x < 8; x++) {
             if (char_data[y] & (0x80 >> x)) {
                 fprintf(f, "#"); // Используем # для заполненных пикселей
@@ -41,20 +42,20 @@ void save_char_as_text(uint8_t *char_data, const char *filename) {
 }
 
 // Функция для сохранения символа в бинарном формате (как есть)
-void save_char_as_binary(uint8_t *char_data, const char *filename) {
+void save_char_as_binary(const uint8_t *char_data, int height, const char *filename) {
     FILE *f = fopen(filename, "wb");
     if (!f) {
         perror("Не удалось создать файл");
         return;
     }
 
-    fwrite(char_data, 1, 16, f);
+    fwrite(char_data, 1, height, f);
     fclose(f);
     printf("Символ сохранен в бинарном формате в файл: %s\n", filename);
 }
 
 // Функция для сохранения символа в формате C-массива
-void save_char_as_c_array(uint8_t *char_data, const char *filename, int char_index) {
+void save_char_as_c_array(const uint8_t *char_data, int height, const char *filename, int char_index) {
     FILE *f = fopen(filename, "w");
     if (!f) {
         perror("Не удалось создать файл");
@@ -62,11 +63,11 @@ void save_char_as_c_array(uint8_t *char_data, const char *filename, int char_ind
     }
 
     fprintf(f, "// DOS font character %d (0x%02X)\n", char_index, char_index);
-    fprintf(f, "const uint8_t char_%d[16] = {\n", char_index);
+    fprintf(f, "const uint8_t char_%d[%d] = {\n", char_index, height);
     
-    for (int y = 0; y < 16; y++) {
+    for (int y = 0; y < height; y++) {
         fprintf(f, "    0x%02X", char_data[y]);
-        if (y < 15) fprintf(f, ",");
+        if (y < height - 1) fprintf(f, ",");
         
         // Добавляем комментарий с визуальным представлением строки
         fprintf(f, " // ");
@@ -81,9 +82,66 @@ void save_char_as_c_array(uint8_t *char_data, const char *filename, int char_ind
     printf("Символ сохранен как C-массив в файл: %s\n", filename);
 }
 
+// Чтение символа из файла шрифта 8x16
+static int read_char(const char *font_file, int char_index, uint8_t *char_data) {
+    // Открываем файл шрифта
+    FILE *f = fopen(font_file, "rb");
+    if (!f) {
+        perror("Не удалось открыть файл шрифта");
+        return 1;
+    }
+
+    // Перемещаемся к нужному символу (каждый символ занимает 16 байт)
+    if (fseek(f, char_index * 16, SEEK_SET) != 0) {
+        perror("Ошибка при позиционировании в файле");
+        fclose(f);
+        return 1;
+    }
+
+    // Считываем данные символа (16 байт)
+    if (fread(char_data, 1, 16, f) != 16) {
+        printf("Ошибка при чтении данных символа\n");
+        fclose(f);
+        return 1;
+    }
+
+    fclose(f);
+    return 0;
+}
+
+// Список шрифтов библиотеки
+static int list_library(const fontlib_t *lib) {
+    fontlib_font_t font;
+    for (uint32_t i = 0; i < lib->hdr->nfonts; i++) {
+        if (fontlib_font(lib, i, &font) != FONTLIB_OK) {
+            printf("Библиотека шрифтов повреждена\n");
+            return 1;
+        }
+        printf("%s\t8x%d\n", font.name, font.height);
+    }
+    return 0;
+}
+
 int main(int argc, char *argv[]) {
+    // С -l шрифт берётся из библиотеки по имени, глиф читается прямо
+    // из отображённого файла
+    fontlib_t lib = { 0 };
+    if (argc >= 3 && strcmp(argv[1], "-l") == 0) {
+        int err = fontlib_open(&lib, argv[2]);
+        if (err != FONTLIB_OK) {
+            printf("Не удалось открыть библиотеку шрифтов %s: %s\n", argv[2], fontlib_strerror(err));
+            return 1;
+        }
+        if (argc == 3) {
+            return list_library(&lib);
+        }
+        argv += 2;
+        argc -= 2;
+    }
+
     if (argc < 3) {
         printf("Использование: %s <файл_шрифта> <номер_символа> [save] [format]\n", argv[0]);
+        printf("       %s -l <библиотека> [<имя_шрифта> <номер_символа> [save] [format]]\n", argv[0]);
         printf("Опции:\n");
         printf("  save   - сохранить символ в файл\n");
         printf("  format - формат сохранения (txt, bin, c) - по умолчанию txt\n");
@@ -111,35 +169,32 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
-    // Открываем файл шрифта
-    FILE *f = fopen(font_file, "rb");
-    if (!f) {
-        perror("Не удалось открыть файл шрифта");
-        return 1;
-    }
+    uint8_t char_buf[16];
+    const uint8_t *char_data = char_buf;
+    int height = 16;
 
-    // Перемещаемся к нужному символу (каждый символ занимает 16 байт)
-    if (fseek(f, char_index * 16, SEEK_SET) != 0) {
-        perror("Ошибка при позиционировании в файле");
-        fclose(f);
-        return 1;
-    }
-
-    // Считываем данные символа (16 байт)
-    uint8_t char_data[16];
-    if (fread(char_data, 1, 16, f) != 16) {
-        printf("Ошибка при чтении данных символа\n");
-        fclose(f);
+    if (lib.data) {
+        fontlib_font_t font;
+        int err = fontlib_find(&lib, font_file, &font);
+        if (err != FONTLIB_OK) {
+            printf("Шрифт %s: %s\n", font_file, fontlib_strerror(err));
+            return 1;
+        }
+        if (char_index >= font.nchars) {
+            printf("В шрифте %s только %d символов\n", font_file, font.nchars);
+            return 1;
+        }
+        char_data = fontlib_glyph(&font, char_index);
+        height = font.height;
+    } else if (read_char(font_file, char_index, char_buf) != 0) {
         return 1;
     }
 
-    fclose(f);
-
     // Выводим информацию о символе
     printf("Символ: %d (0x%02X)\n", char_index, char_index);
     
     // Отображаем символ
-    display_char(char_data);
+    display_char(char_data, height);
 
     // Если нужно сохранить символ
     if (save_mode) {
@@ -147,15 +202,15 @@ int main(int argc, char *argv[]) {
         
         if (strcmp(save_format, "txt") == 0) {
             sprintf(filename, "char_%d.txt", char_index);
-            save_char_as_text(char_data, filename);
+            save_char_as_text(char_data, height, filename);
         } 
         else if (strcmp(save_format, "bin") == 0) {
             sprintf(filename, "char_%d.bin", char_index);
-            save_char_as_binary(char_data, filename);
+            save_char_as_binary(char_data, height, filename);
         } 
         else if (strcmp(save_format, "c") == 0) {
             sprintf(filename, "char_%d.c", char_index);
-            save_char_as_c_array(char_data, filename, char_index);
+            save_char_as_c_array(char_data, height, filename, char_index);
         } 
         else {
             printf("Неизвестный формат сохранения: %s\n", save_format);
@@ -8,6 +8,8 @@
 #include <getopt.h>
 #include <sys/stat.h>
 
+#include "../interleave.h"
+
 #define NORMALIZE   0
 #define MIXING      1
 
@@ -80,6 +82,13 @@ int main(int argc, char *argv[]) {
     filesize = st.st_size;
     
     printf("Filesize = %d bytes\n", filesize);
+
+    // Both halves of the ROM must be present
+    if (filesize < 2 * ODD_BANK_OFFSET) {
+        fprintf(stderr, "Error: File is too small for the ROM layout (at least %d bytes)\n",
+                2 * ODD_BANK_OFFSET);
+        exit(1);
+    }
     
     in_fd = open(filename, O_RDWR, S_IRUSR | S_IWUSR);
     if (in_fd == -1) {
@@ -123,23 +132,12 @@ int main(int argc, char *argv[]) {
     // Process the data
     if (type_oper == NORMALIZE) {
         printf("Processing: Converting ROM format to sequential format...\n");
-        for (int i = 0; i < filesize; i++) {
-            if (i % 2) {
-                out_file_memory[i] = in_file_memory[i/2 + 0x4000];
-            } else {
-                out_file_memory[i] = in_file_memory[i/2];
-            }
-        }
+        deinterleave((uint8_t *)in_file_memory, (uint8_t *)out_file_memory,
+                     filesize, ODD_BANK_OFFSET);
     } else {
         printf("Processing: Converting sequential format to ROM format...\n");
-        // Ensure we don't access memory beyond the mapped region
-        int half_size = filesize / 2;
-        for (int i = 0; i < half_size; i++) {
-            out_file_memory[i] = in_file_memory[i*2];
-            if (i + 0x4000 < filesize && i*2 + 1 < filesize) {
-                out_file_memory[i + 0x4000] = in_file_memory[i*2 + 1];
-            }
-        }
+        interleave((uint8_t *)in_file_memory, (uint8_t *)out_file_memory,
+                   filesize, ODD_BANK_OFFSET);
     }
 
     munmap(in_file_memory, filesize);
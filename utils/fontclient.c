@@ -0,0 +1,164 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../serve.h"
+
+// Тестовый клиент для fontupdate --serve: отправляет образ ROM с
+// параметрами и сохраняет полученный результат
+
+static int write_full(int fd, const void *buf, size_t len) {
+    const uint8_t *p = buf;
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static int read_full(int fd, void *buf, size_t len) {
+    uint8_t *p = buf;
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -1;
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static int read_line(int fd, char *line, int max) {
+    int len = 0;
+    while (len < max - 1) {
+        if (read_full(fd, &line[len], 1) != 0) return -1;
+        if (line[len] == '\n') break;
+        len++;
+    }
+    line[len] = '\0';
+    return len;
+}
+
+int main(int argc, char *argv[]) {
+    int repeat = 1;
+    int argi = 1;
+
+    if (argi + 1 < argc && strcmp(argv[argi], "-r") == 0) {
+        repeat = atoi(argv[argi + 1]);
+        argi += 2;
+    }
+    if (argc - argi < 3 || repeat < 1) {
+        fprintf(stderr, "Usage: %s [-r count] <socket> <input_rom> <output_rom> [fontupdate options]\n", argv[0]);
+        fprintf(stderr, "Example: %s /tmp/fu.sock card.bin card_rus.bin -6 rkega-8x16.fnt\n", argv[0]);
+        return 1;
+    }
+    const char *socket_path = argv[argi];
+    const char *input = argv[argi + 1];
+    const char *output = argv[argi + 2];
+
+    // Заголовок запроса: размер и параметры через пробел
+    FILE *f = fopen(input, "rb");
+    if (!f) {
+        perror("Cannot open input file");
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    rewind(f);
+    if (size < 2 || size > SERVE_MAX_ROM) {
+        fprintf(stderr, "Error: Unsupported ROM size %ld\n", size);
+        fclose(f);
+        return 1;
+    }
+    uint8_t *rom = malloc(size);
+    uint8_t *result = malloc(SERVE_MAX_ROM);
+    if (!rom || !result || fread(rom, 1, size, f) != (size_t)size) {
+        perror("Read error");
+        fclose(f);
+        free(rom);
+        free(result);
+        return 1;
+    }
+    fclose(f);
+
+    char header[SERVE_MAX_HEADER];
+    int hlen = snprintf(header, sizeof(header), "%ld", size);
+    for (int i = argi + 3; i < argc && hlen < (int)sizeof(header); i++) {
+        hlen += snprintf(header + hlen, sizeof(header) - hlen, " %s", argv[i]);
+    }
+    if (hlen >= (int)sizeof(header) - 1) {
+        fprintf(stderr, "Error: Too many options\n");
+        free(rom);
+        free(result);
+        return 1;
+    }
+    header[hlen++] = '\n';
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, socket_path, sizeof(addr.sun_path) - 1);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd == -1 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        perror("Cannot connect to server");
+        free(rom);
+        free(result);
+        return 1;
+    }
+
+    // Все повторы идут по одному соединению
+    struct timespec t0, t1;
+    int result_size = 0;
+    int rc = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int r = 0; r < repeat && rc == 0; r++) {
+        char reply[320];
+        if (write_full(fd, header, hlen) != 0 || write_full(fd, rom, size) != 0 ||
+            read_line(fd, reply, sizeof(reply)) < 0) {
+            fprintf(stderr, "Error: Connection lost\n");
+            rc = 1;
+        } else if (strncmp(reply, "OK ", 3) != 0) {
+            fprintf(stderr, "Server: %s\n", reply);
+            rc = 1;
+        } else {
+            result_size = atoi(reply + 3);
+            if (result_size < 0 || result_size > SERVE_MAX_ROM ||
+                read_full(fd, result, result_size) != 0) {
+                fprintf(stderr, "Error: Bad reply\n");
+                rc = 1;
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    close(fd);
+
+    if (rc == 0) {
+        f = fopen(output, "wb");
+        if (!f || fwrite(result, 1, result_size, f) != (size_t)result_size) {
+            perror("Cannot write output file");
+            rc = 1;
+        }
+        if (f) fclose(f);
+    }
+    if (rc == 0) {
+        double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+        printf("%d request(s), %.3f ms per request. Output written to %s\n",
+               repeat, secs * 1000 / repeat, output);
+    }
+
+    free(rom);
+    free(result);
+    return rc;
+}
@@ -0,0 +1,316 @@
+// Сборка библиотеки шрифтов (формат в fontlib.h) из каталогов со
+// шрифтами. Имя шрифта - путь файла относительно каталога без
+// расширения .fnt; высота глифа - размер файла / 256. Одинаковые
+// глифы всех шрифтов записываются один раз.
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <getopt.h>
+#include <sys/stat.h>
+#include "../fontlib.h"
+
+#define GLYPHS 256
+#define MAX_HEIGHT 32
+#define MAX_PATH 4096
+
+typedef struct {
+    char *name;
+    char *path;
+    int height;
+} font_file_t;
+
+static font_file_t *files = NULL;
+static int nfiles = 0;
+
+// Глифы библиотеки и хеш-таблица для поиска повторов
+typedef struct {
+    uint32_t offset;
+    uint32_t height;        // 0 - свободно
+} glyph_slot_t;
+
+static uint8_t *glyphs = NULL;
+static size_t glyphs_size = 0, glyphs_cap = 0;
+static glyph_slot_t *slots = NULL;
+static uint32_t nslots = 0, nunique = 0;
+static long nglyphs = 0;
+
+static void *xrealloc(void *p, size_t size) {
+    void *q = realloc(p, size);
+    if (!q) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    return q;
+}
+
+static int add_file(const char *path, const char *name, off_t size) {
+    if (size % GLYPHS != 0 || size / GLYPHS == 0 || size / GLYPHS > MAX_HEIGHT) {
+        fprintf(stderr, "Skipping %s: size %ld is not 256 glyphs of 1-%d bytes\n",
+                path, (long)size, MAX_HEIGHT);
+        return 0;
+    }
+    files = xrealloc(files, (nfiles + 1) * sizeof(*files));
+    font_file_t *f = &files[nfiles++];
+    f->path = strdup(path);
+    f->name = strdup(name);
+    if (!f->path || !f->name) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    size_t len = strlen(f->name);
+    if (len > 4 && strcmp(f->name + len - 4, ".fnt") == 0) {
+        f->name[len - 4] = '\0';
+    }
+    f->height = size / GLYPHS;
+    return 0;
+}
+
+// Обход каталога с подкаталогами; prefix - путь относительно корня
+static int scan_dir(const char *dir, const char *prefix) {
+    DIR *d = opendir(dir);
+    if (!d) {
+        perror(dir);
+        return -1;
+    }
+    struct dirent *de;
+    int rc = 0;
+    while (rc == 0 && (de = readdir(d)) != NULL) {
+        char path[MAX_PATH], name[MAX_PATH];
+        struct stat st;
+        if (de->d_name[0] == '.') {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s", dir, de->d_name);
+        snprintf(name, sizeof(name), "%s%s", prefix, de->d_name);
+        if (stat(path, &st) != 0) {
+            perror(path);
+            rc = -1;
+        } else if (S_ISDIR(st.st_mode)) {
+            strcat(name, "/");
+            rc = scan_dir(path, name);
+        } else if (S_ISREG(st.st_mode)) {
+            rc = add_file(path, name, st.st_size);
+        }
+    }
+    closedir(d);
+    return rc;
+}
+
+static int by_name(const void *a, const void *b) {
+    return strcmp(((const font_file_t *)a)->name, ((const font_file_t *)b)->name);
+}
+
+static uint64_t glyph_hash(const uint8_t *glyph, int height) {
+    uint64_t h = 0xCBF29CE484222325ULL ^ height;
+    for (int i = 0; i < height; i++) {
+        h = (h ^ glyph[i]) * 0x100000001B3ULL;
+    }
+    return h;
+}
+
+static glyph_slot_t *find_slot(const uint8_t *glyph, int height) {
+    uint32_t mask = nslots - 1;
+    uint32_t i = glyph_hash(glyph, height) & mask;
+    while (slots[i].height != 0 &&
+           (slots[i].height != (uint32_t)height ||
+            memcmp(glyphs + slots[i].offset, glyph, height) != 0)) {
+        i = (i + 1) & mask;
+    }
+    return &slots[i];
+}
+
+// Таблица заполняется не больше чем наполовину
+static void grow_slots(void) {
+    glyph_slot_t *old = slots;
+    uint32_t nold = nslots;
+
+    nslots = nslots ? nslots * 2 : 4096;
+    slots = calloc(nslots, sizeof(*slots));
+    if (!slots) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    for (uint32_t i = 0; i < nold; i++) {
+        if (old[i].height) {
+            *find_slot(glyphs + old[i].offset, old[i].height) = old[i];
+        }
+    }
+    free(old);
+}
+
+// Смещение такого же глифа в области глифов; новый глиф дописывается
+static uint32_t put_glyph(const uint8_t *glyph, int height) {
+    nglyphs++;
+    if ((nunique + 1) * 2 > nslots) {
+        grow_slots();
+    }
+    glyph_slot_t *slot = find_slot(glyph, height);
+    if (slot->height) {
+        return slot->offset;
+    }
+    if (glyphs_size + height > glyphs_cap) {
+        glyphs_cap = glyphs_cap ? glyphs_cap * 2 : 65536;
+        glyphs = xrealloc(glyphs, glyphs_cap);
+    }
+    slot->offset = glyphs_size;
+    slot->height = height;
+    memcpy(glyphs + glyphs_size, glyph, height);
+    glyphs_size += height;
+    nunique++;
+    return slot->offset;
+}
+
+static uint8_t *read_font(const font_file_t *f) {
+    size_t size = (size_t)GLYPHS * f->height;
+    uint8_t *buf = xrealloc(NULL, size);
+    FILE *in = fopen(f->path, "rb");
+    if (!in || fread(buf, 1, size, in) != size) {
+        perror(f->path);
+        if (in) fclose(in);
+        free(buf);
+        return NULL;
+    }
+    fclose(in);
+    return buf;
+}
+
+static int write_all(FILE *out, const void *data, size_t size) {
+    return size == 0 || fwrite(data, 1, size, out) == size ? 0 : -1;
+}
+
+static int write_library(const char *path, uint32_t **tables) {
+    fontlib_header_t hdr;
+    uint32_t nbuckets = 16;
+    while (nbuckets < (uint32_t)nfiles * 2) {
+        nbuckets *= 2;
+    }
+
+    // Раскладка файла
+    uint64_t names_size = 0;
+    for (int i = 0; i < nfiles; i++) {
+        names_size += strlen(files[i].name) + 1;
+    }
+    uint64_t buckets_off = sizeof(hdr);
+    uint64_t fonts_off = buckets_off + (uint64_t)nbuckets * sizeof(uint32_t);
+    uint64_t names_off = fonts_off + (uint64_t)nfiles * sizeof(fontlib_rec_t);
+    uint64_t tables_off = (names_off + names_size + 3) & ~3ULL;
+    uint64_t glyphs_off = tables_off + (uint64_t)nfiles * GLYPHS * sizeof(uint32_t);
+    uint64_t total = glyphs_off + glyphs_size;
+    if (total > UINT32_MAX) {
+        fprintf(stderr, "Error: The library would exceed 4 GB\n");
+        return -1;
+    }
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, FONTLIB_MAGIC, sizeof(hdr.magic));
+    hdr.nfonts = nfiles;
+    hdr.nbuckets = nbuckets;
+    hdr.buckets = buckets_off;
+    hdr.fonts = fonts_off;
+    hdr.size = total;
+
+    uint32_t *buckets = calloc(nbuckets, sizeof(*buckets));
+    fontlib_rec_t *recs = calloc(nfiles ? nfiles : 1, sizeof(*recs));
+    if (!buckets || !recs) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    uint32_t name_pos = names_off;
+    for (int i = 0; i < nfiles; i++) {
+        recs[i].name = name_pos;
+        recs[i].hash = fontlib_hash(files[i].name);
+        recs[i].height = files[i].height;
+        recs[i].nchars = GLYPHS;
+        recs[i].glyphs = tables_off + (uint64_t)i * GLYPHS * sizeof(uint32_t);
+        name_pos += strlen(files[i].name) + 1;
+
+        uint32_t j = recs[i].hash & (nbuckets - 1);
+        while (buckets[j] != 0) {
+            j = (j + 1) & (nbuckets - 1);
+        }
+        buckets[j] = i + 1;
+        // Смещения глифов - от начала файла
+        for (int c = 0; c < GLYPHS; c++) {
+            tables[i][c] += glyphs_off;
+        }
+    }
+
+    FILE *out = fopen(path, "wb");
+    if (!out) {
+        perror(path);
+        return -1;
+    }
+    static const uint8_t pad[4] = { 0 };
+    int rc = write_all(out, &hdr, sizeof(hdr));
+    rc |= write_all(out, buckets, nbuckets * sizeof(*buckets));
+    rc |= write_all(out, recs, nfiles * sizeof(*recs));
+    for (int i = 0; i < nfiles; i++) {
+        rc |= write_all(out, files[i].name, strlen(files[i].name) + 1);
+    }
+    rc |= write_all(out, pad, tables_off - names_off - names_size);
+    for (int i = 0; i < nfiles; i++) {
+        rc |= write_all(out, tables[i], GLYPHS * sizeof(uint32_t));
+    }
+    rc |= write_all(out, glyphs, glyphs_size);
+    if (fclose(out) != 0) {
+        rc = -1;
+    }
+    if (rc != 0) {
+        perror(path);
+    }
+    free(buckets);
+    free(recs);
+    printf("%d fonts, %ld glyphs (%u unique), library %lu bytes\n",
+           nfiles, nglyphs, nunique, (unsigned long)total);
+    return rc;
+}
+
+int main(int argc, char *argv[]) {
+    const char *output = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:")) != -1) {
+        if (opt != 'o') {
+            output = NULL;
+            break;
+        }
+        output = optarg;
+    }
+    if (!output || opt != -1 || optind >= argc) {
+        fprintf(stderr, "Usage: %s -o <library> <font_dir>...\n", argv[0]);
+        return 1;
+    }
+
+    for (int i = optind; i < argc; i++) {
+        if (scan_dir(argv[i], "") != 0) {
+            return 1;
+        }
+    }
+    qsort(files, nfiles, sizeof(*files), by_name);
+    for (int i = 1; i < nfiles; i++) {
+        if (strcmp(files[i - 1].name, files[i].name) == 0) {
+            fprintf(stderr, "Error: Font name %s is used by %s and %s\n",
+                    files[i].name, files[i - 1].path, files[i].path);
+            return 1;
+        }
+    }
+
+    uint32_t **tables = xrealloc(NULL, (nfiles ? nfiles : 1) * sizeof(*tables));
+    long font_bytes = 0;
+    for (int i = 0; i < nfiles; i++) {
+        uint8_t *font = read_font(&files[i]);
+        if (!font) {
+            return 1;
+        }
+        tables[i] = xrealloc(NULL, GLYPHS * sizeof(uint32_t));
+        for (int c = 0; c < GLYPHS; c++) {
+            tables[i][c] = put_glyph(font + c * files[i].height, files[i].height);
+        }
+        font_bytes += GLYPHS * files[i].height;
+        free(font);
+    }
+    printf("Font files: %ld bytes\n", font_bytes);
+    return write_library(output, tables) == 0 ? 0 : 1;
+}
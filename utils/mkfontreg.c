@@ -0,0 +1,264 @@
+// Генератор реестра встроенных шрифтов (fontreg_data.c) из файлов
+// <имя>-8x8.fnt, <имя>-8x14.fnt и <имя>-8x16.fnt. Формат данных описан
+// в fontreg.h: у глифа отбрасываются нулевые строки сверху и снизу,
+// а глиф, уже записанный в таблицы той же высоты, заменяется ссылкой.
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <getopt.h>
+#include "../fontreg.h"
+
+#define GLYPHS 256
+#define MAX_FONTS 256
+#define MAX_NAME 64
+#define MAX_DATA (1 << 24)      // смещение ссылки - 3 байта
+
+static const int glyph_height[FONTREG_TABLES] = { 8, 14, 16 };
+static const char *const table_name[FONTREG_TABLES] = { "8x8", "8x14", "8x16" };
+
+typedef struct {
+    char name[MAX_NAME];
+    int32_t table[FONTREG_TABLES];
+} font_t;
+
+// Таблицы одной высоты: упакованные данные и уже записанные глифы
+typedef struct {
+    uint8_t *data;
+    int size;
+    const uint8_t **glyphs;     // исходные строки записанных глифов
+    int *offsets;               // и их смещения в data
+    int nglyphs;
+    int refs;                   // глифов, заменённых ссылкой
+    int raw;                    // размер таблиц без упаковки
+} pack_t;
+
+static font_t fonts[MAX_FONTS];
+static int nfonts = 0;
+static pack_t packs[FONTREG_TABLES];
+
+static uint8_t *read_font(const char *path, int size) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return NULL;
+    }
+    uint8_t *buf = malloc(size + 1);
+    int n = buf ? (int)fread(buf, 1, size + 1, f) : -1;
+    fclose(f);
+    if (n != size) {
+        fprintf(stderr, "Error: %s must be exactly %d bytes\n", path, size);
+        free(buf);
+        return NULL;
+    }
+    return buf;
+}
+
+// Разбор имени файла: <каталог>/<имя>-8x<высота>.fnt
+static int parse_name(const char *path, char *name, int *table) {
+    const char *base = strrchr(path, '/');
+    base = base ? base + 1 : path;
+    const char *dash = strrchr(base, '-');
+    if (!dash || dash == base || dash - base >= MAX_NAME) {
+        return -1;
+    }
+    for (int t = 0; t < FONTREG_TABLES; t++) {
+        char suffix[16];
+        snprintf(suffix, sizeof(suffix), "-%s.fnt", table_name[t]);
+        if (strcmp(dash, suffix) == 0) {
+            memcpy(name, base, dash - base);
+            name[dash - base] = '\0';
+            *table = t;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static font_t *get_font(const char *name) {
+    for (int i = 0; i < nfonts; i++) {
+        if (strcmp(fonts[i].name, name) == 0) {
+            return &fonts[i];
+        }
+    }
+    if (nfonts == MAX_FONTS) {
+        return NULL;
+    }
+    font_t *font = &fonts[nfonts++];
+    strcpy(font->name, name);
+    for (int t = 0; t < FONTREG_TABLES; t++) {
+        font->table[t] = FONTREG_NONE;
+    }
+    return font;
+}
+
+static void put_glyph(pack_t *pack, const uint8_t *glyph, int height) {
+    int top = 0, bottom = height;
+    while (top < height && glyph[top] == 0) {
+        top++;
+    }
+    if (top == height) {
+        pack->data[pack->size++] = FONTREG_BLANK;
+        return;
+    }
+    while (glyph[bottom - 1] == 0) {
+        bottom--;
+    }
+    int rows = bottom - top;
+
+    // Ссылка занимает 4 байта и выгодна только для глифов длиннее
+    if (rows + 1 > 4) {
+        for (int i = 0; i < pack->nglyphs; i++) {
+            if (memcmp(pack->glyphs[i], glyph, height) == 0) {
+                int off = pack->offsets[i];
+                uint8_t *p = pack->data + pack->size;
+                p[0] = FONTREG_REF;
+                p[1] = off & 0xFF;
+                p[2] = (off >> 8) & 0xFF;
+                p[3] = (off >> 16) & 0xFF;
+                pack->size += 4;
+                pack->refs++;
+                return;
+            }
+        }
+        pack->glyphs[pack->nglyphs] = glyph;
+        pack->offsets[pack->nglyphs++] = pack->size;
+    }
+    pack->data[pack->size++] = top << 4 | (rows - 1);
+    memcpy(pack->data + pack->size, glyph + top, rows);
+    pack->size += rows;
+}
+
+static int add_table(font_t *font, int t, const uint8_t *table) {
+    pack_t *pack = &packs[t];
+    int height = glyph_height[t];
+
+    if (font->table[t] != FONTREG_NONE) {
+        fprintf(stderr, "Error: Duplicate %s table for font %s\n", table_name[t], font->name);
+        return -1;
+    }
+    // Упакованная таблица не длиннее GLYPHS * (height + 1) байт
+    int need = pack->size + GLYPHS * (height + 1);
+    if (need > MAX_DATA) {
+        fprintf(stderr, "Error: Too many %s tables\n", table_name[t]);
+        return -1;
+    }
+    pack->data = realloc(pack->data, need);
+    pack->glyphs = realloc(pack->glyphs, (pack->nglyphs + GLYPHS) * sizeof(*pack->glyphs));
+    pack->offsets = realloc(pack->offsets, (pack->nglyphs + GLYPHS) * sizeof(*pack->offsets));
+    if (!pack->data || !pack->glyphs || !pack->offsets) {
+        perror("Memory allocation failed");
+        return -1;
+    }
+
+    font->table[t] = pack->size;
+    for (int c = 0; c < GLYPHS; c++) {
+        put_glyph(pack, table + c * height, height);
+    }
+    pack->raw += GLYPHS * height;
+    return 0;
+}
+
+static void write_bytes(FILE *f, const char *name, const uint8_t *data, int size) {
+    fprintf(f, "static const uint8_t %s[%d] = {", name, size ? size : 1);
+    for (int i = 0; i < size; i++) {
+        fprintf(f, "%s0x%02x,", i % 16 ? " " : "\n    ", data[i]);
+    }
+    fprintf(f, "%s\n};\n\n", size ? "" : "\n    0");
+}
+
+static int write_registry(const char *path, int def) {
+    FILE *f = path ? fopen(path, "w") : stdout;
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+
+    fprintf(f, "// Сгенерировано utils/mkfontreg, не редактировать\n");
+    fprintf(f, "#include \"fontreg.h\"\n\n");
+    for (int t = 0; t < FONTREG_TABLES; t++) {
+        char name[32];
+        snprintf(name, sizeof(name), "data_%s", table_name[t]);
+        write_bytes(f, name, packs[t].data, packs[t].size);
+    }
+    fprintf(f, "const uint8_t *const fontreg_data[FONTREG_TABLES] = {\n");
+    fprintf(f, "    data_8x8, data_8x14, data_8x16\n};\n\n");
+
+    fprintf(f, "const fontreg_entry_t fontreg_entries[] = {\n");
+    for (int i = 0; i < nfonts; i++) {
+        fprintf(f, "    { \"%s\", { %d, %d, %d } },\n", fonts[i].name,
+                fonts[i].table[0], fonts[i].table[1], fonts[i].table[2]);
+    }
+    if (nfonts == 0) {
+        fprintf(f, "    { 0, { FONTREG_NONE, FONTREG_NONE, FONTREG_NONE } }\n");
+    }
+    fprintf(f, "};\n\n");
+    fprintf(f, "const int fontreg_nentries = %d;\n", nfonts);
+    fprintf(f, "const int fontreg_default = %d;\n", def);
+
+    if (f != stdout && fclose(f) != 0) {
+        perror(path);
+        return -1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    const char *output = NULL;
+    const char *def_name = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:d:")) != -1) {
+        switch (opt) {
+            case 'o':
+                output = optarg;
+                break;
+            case 'd':
+                def_name = optarg;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-d default_font] [-o fontreg_data.c] <name>-8x<8|14|16>.fnt...\n", argv[0]);
+                return 1;
+        }
+    }
+
+    for (int i = optind; i < argc; i++) {
+        char name[MAX_NAME];
+        int t;
+        if (parse_name(argv[i], name, &t) != 0) {
+            fprintf(stderr, "Error: %s is not named <name>-8x8.fnt, -8x14.fnt or -8x16.fnt\n", argv[i]);
+            return 1;
+        }
+        font_t *font = get_font(name);
+        if (!font) {
+            fprintf(stderr, "Error: Too many fonts\n");
+            return 1;
+        }
+        // Глифы записанных таблиц нужны для поиска повторов до конца
+        uint8_t *table = read_font(argv[i], GLYPHS * glyph_height[t]);
+        if (!table || add_table(font, t, table) != 0) {
+            return 1;
+        }
+    }
+
+    int def = 0;
+    if (def_name) {
+        for (def = 0; def < nfonts && strcmp(fonts[def].name, def_name) != 0; def++) {
+        }
+        if (def == nfonts) {
+            fprintf(stderr, "Error: Default font %s not found\n", def_name);
+            return 1;
+        }
+    }
+
+    if (write_registry(output, def) != 0) {
+        return 1;
+    }
+    for (int t = 0; t < FONTREG_TABLES; t++) {
+        if (packs[t].raw) {
+            fprintf(stderr, "%s: %d bytes packed to %d, %d glyphs shared\n",
+                    table_name[t], packs[t].raw, packs[t].size, packs[t].refs);
+        }
+    }
+    return 0;
+}
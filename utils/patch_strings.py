@@ -64,15 +64,12 @@ def load_patterns(json_file):
     
     return patterns
 
-def calculate_vga_checksum(data):
-    """Вычисляет контрольную сумму как в addchecksum.c"""
-    checksum = 0
-    # Суммируем все байты, кроме последнего
-    for i in range(len(data) - 1):
-        checksum = (checksum + data[i]) & 0xFF
-    # Инвертируем для получения нулевой суммы
-    checksum = (-checksum) & 0xFF
-    return checksum
+def adjust_sum(byte_sum, data, pos, new_bytes):
+    """Поправляет сумму байт (без последнего) на замену data[pos:] на new_bytes"""
+    end = min(pos + len(new_bytes), len(data) - 1)
+    for i in range(pos, end):
+        byte_sum += new_bytes[i - pos] - data[i]
+    return byte_sum & 0xFF
 
 def patch_bios(rom_file, output_file, patterns):
     with open(rom_file, 'rb') as f:
@@ -83,6 +80,10 @@ def patch_bios(rom_file, output_file, patterns):
     # Запоминаем оригинальную контрольную сумму для отчёта
     original_checksum = data[-1] if len(data) > 0 else 0
     print(f"Оригинальная контрольная сумма (последний байт): 0x{original_checksum:02X}")
+
+    # Сумма всех байт, кроме последнего; замены поправляют её по месту,
+    # так что весь образ суммируется только один раз
+    byte_sum = sum(data[:-1]) & 0xFF
     
     for eng_bytes, rus_bytes, eng_str, rus_str in patterns:
         if len(eng_bytes) != len(rus_bytes):
@@ -103,6 +104,7 @@ def patch_bios(rom_file, output_file, patterns):
                 break
             
             print(f"  Найдено по адресу {pos} (0x{pos:x})")
+            byte_sum = adjust_sum(byte_sum, data, pos, rus_bytes)
             for i in range(len(eng_bytes)):
                 data[pos + i] = rus_bytes[i]
             found += 1
@@ -110,8 +112,8 @@ def patch_bios(rom_file, output_file, patterns):
         
         print(f"  Заменено {found} раз")
     
-    # Вычисляем новую контрольную сумму (алгоритм из addchecksum.c)
-    new_checksum = calculate_vga_checksum(data)
+    # Новая контрольная сумма дополняет сумму байт до нуля (как в addchecksum.c)
+    new_checksum = (-byte_sum) & 0xFF
     
     # Записываем контрольную сумму в последний байт
     if len(data) > 0:
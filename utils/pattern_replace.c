@@ -1,6 +1,11 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "../patreplace.h"
 
 // Function to read a file into a buffer
 unsigned char* read_file(const char* filename, size_t* size) {
@@ -36,42 +41,117 @@ unsigned char* read_file(const char* filename, size_t* size) {
     return buffer;
 }
 
-// Function to search for a pattern and replace it
+// Function to map a whole file into memory. A writable mapping is shared,
+// so changes go straight to the file. Empty files get no mapping.
+unsigned char* map_file(const char* filename, size_t* size, int writable) {
+    int fd = open(filename, writable ? O_RDWR : O_RDONLY);
+    if (fd == -1) {
+        fprintf(stderr, "Error: Could not open file %s\n", filename);
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        fprintf(stderr, "Error: Could not get size of file %s\n", filename);
+        close(fd);
+        return NULL;
+    }
+    *size = st.st_size;
+    if (*size == 0) {
+        close(fd);
+        return (unsigned char*)"";
+    }
+
+    void* data = mmap(NULL, *size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                      writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        fprintf(stderr, "Error: Could not map file %s\n", filename);
+        return NULL;
+    }
+    return data;
+}
+
+void unmap_file(unsigned char* data, size_t size) {
+    if (size > 0) {
+        munmap(data, size);
+    }
+}
+
+// Function to check whether two paths name the same existing file
+int same_file(const char* a, const char* b) {
+    struct stat sa, sb;
+    return stat(a, &sa) == 0 && stat(b, &sb) == 0 &&
+           sa.st_dev == sb.st_dev && sa.st_ino == sb.st_ino;
+}
+
+// Function to search for a pattern and replace it. Matches are found
+// with a vectorized scan, and the result is assembled in the mapped
+// output file by copying whole runs between them.
 int search_and_replace(unsigned char* source, size_t source_size,
                        unsigned char* find_pattern, size_t find_size,
                        unsigned char* replace_pattern, size_t replace_size,
                        const char* output_filename) {
-    
-    FILE* output_file = fopen(output_filename, "wb");
-    if (!output_file) {
+    size_t* matches;
+    long replacements = patreplace_find(source, source_size, find_pattern, find_size, &matches);
+    if (replacements < 0) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return -1;
+    }
+    size_t output_size = patreplace_size(source_size, replacements, find_size, replace_size);
+
+    int fd = open(output_filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) {
         fprintf(stderr, "Error: Could not create output file %s\n", output_filename);
+        free(matches);
         return -1;
     }
-    
-    size_t pos = 0;
-    int replacements = 0;
-    
-    while (pos <= source_size - find_size) {
-        // Check if pattern matches at current position
-        if (memcmp(source + pos, find_pattern, find_size) == 0) {
-            // Write replacement pattern
-            fwrite(replace_pattern, 1, replace_size, output_file);
-            pos += find_size;
-            replacements++;
-        } else {
-            // Write current byte
-            fwrite(&source[pos], 1, 1, output_file);
-            pos++;
+    if (ftruncate(fd, output_size) != 0) {
+        fprintf(stderr, "Error: Could not resize output file %s\n", output_filename);
+        close(fd);
+        free(matches);
+        return -1;
+    }
+
+    if (output_size > 0) {
+        unsigned char* output = mmap(NULL, output_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (output == MAP_FAILED) {
+            fprintf(stderr, "Error: Could not map output file %s\n", output_filename);
+            close(fd);
+            free(matches);
+            return -1;
         }
+        patreplace_copy(source, source_size, matches, replacements, find_size,
+                        replace_pattern, replace_size, output);
+        munmap(output, output_size);
     }
-    
-    // Write remaining bytes if any
-    if (pos < source_size) {
-        fwrite(&source[pos], 1, source_size - pos, output_file);
+
+    close(fd);
+    free(matches);
+    return (int)replacements;
+}
+
+// Function to replace a pattern with one of the same length directly in
+// the mapped source file: only the matches themselves are written
+int replace_in_place(const char* source_filename,
+                     unsigned char* find_pattern, size_t find_size,
+                     unsigned char* replace_pattern) {
+    size_t source_size;
+    unsigned char* source = map_file(source_filename, &source_size, 1);
+    if (!source) return -1;
+
+    size_t* matches;
+    long replacements = patreplace_find(source, source_size, find_pattern, find_size, &matches);
+    if (replacements < 0) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        unmap_file(source, source_size);
+        return -1;
     }
-    
-    fclose(output_file);
-    return replacements;
+    patreplace_inplace(source, matches, replacements, replace_pattern, find_size);
+
+    free(matches);
+    unmap_file(source, source_size);
+    return (int)replacements;
 }
 
 int main(int argc, char* argv[]) {
@@ -101,67 +181,72 @@ int main(int argc, char* argv[]) {
         return 1;
     }
     
-    size_t source_size, find_size, replace_size;
+    // The source is mapped while the output is written, so an output
+    // naming the source file is handled as in-place replacement
+    if (!in_place && same_file(source_filename, output_filename)) {
+        in_place = 1;
+    }
     
-    // Read source file
-    unsigned char* source = read_file(source_filename, &source_size);
-    if (!source) return 1;
+    size_t source_size, find_size, replace_size;
     
     // Read find pattern
     unsigned char* find_pattern = read_file(find_pattern_filename, &find_size);
-    if (!find_pattern) {
-        free(source);
+    if (!find_pattern) return 1;
+    if (find_size == 0) {
+        fprintf(stderr, "Error: Find pattern %s is empty\n", find_pattern_filename);
+        free(find_pattern);
         return 1;
     }
     
     // Read replace pattern
     unsigned char* replace_pattern = read_file(replace_pattern_filename, &replace_size);
     if (!replace_pattern) {
-        free(source);
         free(find_pattern);
         return 1;
     }
     
-    // For in-place replacement, use a temporary file
-    char* temp_filename = NULL;
-    if (in_place) {
-        temp_filename = malloc(strlen(source_filename) + 5);
-        if (!temp_filename) {
-            fprintf(stderr, "Error: Memory allocation failed\n");
-            free(source);
+    int replacements;
+    if (in_place && replace_size == find_size) {
+        // Same length: patch the source file without rewriting it
+        replacements = replace_in_place(source_filename, find_pattern, find_size, replace_pattern);
+    } else {
+        // Map source file
+        unsigned char* source = map_file(source_filename, &source_size, 0);
+        if (!source) {
             free(find_pattern);
             free(replace_pattern);
             return 1;
         }
-        sprintf(temp_filename, "%s.tmp", source_filename);
-        output_filename = temp_filename;
-    }
-    
-    // Perform search and replace
-    int replacements = search_and_replace(source, source_size, 
-                                         find_pattern, find_size, 
-                                         replace_pattern, replace_size, 
-                                         output_filename);
-    
-    // If in-place replacement and successful, replace the original file
-    if (in_place && replacements >= 0) {
-        if (remove(source_filename) != 0) {
-            fprintf(stderr, "Error: Failed to remove original file %s\n", source_filename);
-            free(source);
-            free(find_pattern);
-            free(replace_pattern);
-            free(temp_filename);
-            return 1;
+        
+        // For in-place replacement, use a temporary file
+        char* temp_filename = NULL;
+        if (in_place) {
+            temp_filename = malloc(strlen(source_filename) + 5);
+            if (!temp_filename) {
+                fprintf(stderr, "Error: Memory allocation failed\n");
+                unmap_file(source, source_size);
+                free(find_pattern);
+                free(replace_pattern);
+                return 1;
+            }
+            sprintf(temp_filename, "%s.tmp", source_filename);
+            output_filename = temp_filename;
         }
-        if (rename(temp_filename, source_filename) != 0) {
+        
+        // Perform search and replace
+        replacements = search_and_replace(source, source_size,
+                                          find_pattern, find_size,
+                                          replace_pattern, replace_size,
+                                          output_filename);
+        unmap_file(source, source_size);
+        
+        // If in-place replacement and successful, replace the original file
+        if (in_place && replacements >= 0 && rename(temp_filename, source_filename) != 0) {
             fprintf(stderr, "Error: Failed to rename temporary file to %s\n", source_filename);
             fprintf(stderr, "Your data is saved in %s\n", temp_filename);
-            free(source);
-            free(find_pattern);
-            free(replace_pattern);
-            free(temp_filename);
-            return 1;
+            replacements = -1;
         }
+        free(temp_filename);
     }
     
     if (replacements >= 0) {
@@ -169,12 +254,8 @@ int main(int argc, char* argv[]) {
     }
     
     // Clean up
-    free(source);
     free(find_pattern);
     free(replace_pattern);
-    if (temp_filename) {
-        free(temp_filename);
-    }
     
     return (replacements >= 0) ? 0 : 1;
 }
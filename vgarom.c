@@ -0,0 +1,890 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "vgarom.h"
+#include "fontscan.h"
+#include "interleave.h"
+
+static const int font_sizes[VGAROM_FONT_COUNT] = {
+    FONT_8X8_SIZE, FONT_8X14_SIZE, FONT_8X16_SIZE
+};
+
+static const int alt_heights[VGAROM_ALT_COUNT] = { 14, 16 };
+
+// Таблица alt той же высоты, что и таблица шрифта font, или -1
+static int alt_for_font(int font) {
+    return font == VGAROM_FONT_8X14 ? VGAROM_ALT_9X14 :
+           font == VGAROM_FONT_8X16 ? VGAROM_ALT_9X16 : -1;
+}
+
+static void clear_alt_tables(vgarom_t *rom) {
+    for (int a = 0; a < VGAROM_ALT_COUNT; a++) {
+        rom->alt[a].offset = -1;
+        rom->alt[a].height = alt_heights[a];
+        rom->alt[a].nrecords = 0;
+        memset(rom->alt[a].record, VGAROM_ALT_NONE, sizeof(rom->alt[a].record));
+    }
+}
+
+// Разбирает таблицу исправлений по смещению offset (-1 - таблицы нет)
+// и строит индекс по кодам символов. При повторе символа в индекс
+// попадает последняя запись: BIOS загружает записи по порядку.
+static int index_alt_table(const uint8_t *data, int size, int offset, int height,
+                           vgarom_alt_t *alt) {
+    alt->offset = -1;
+    alt->height = height;
+    alt->nrecords = 0;
+    memset(alt->record, VGAROM_ALT_NONE, sizeof(alt->record));
+    if (offset < 0) {
+        return 0;
+    }
+    int len = alt_table_size(data, size, offset, height + 1);
+    if (len < 0 || (len - 1) / (height + 1) >= VGAROM_ALT_NONE) {
+        return -1;
+    }
+    alt->offset = offset;
+    alt->nrecords = (len - 1) / (height + 1);
+    for (int i = 0; i < alt->nrecords; i++) {
+        alt->record[data[offset + i * (height + 1)]] = i;
+    }
+    return 0;
+}
+
+int vgarom_font_size(int font) {
+    if (font < 0 || font >= VGAROM_FONT_COUNT) {
+        return 0;
+    }
+    return font_sizes[font];
+}
+
+int vgarom_check_image(const uint8_t *image, int size, unsigned flags) {
+    if (!image || size < 2) {
+        return VGAROM_ERR_ARG;
+    }
+    if (!(flags & VGAROM_LINEAR) && size < ODD_BANK_OFFSET * 2) {
+        return VGAROM_ERR_SIZE;
+    }
+    if (image[0] != 0x55 || image[(flags & VGAROM_LINEAR) ? 1 : ODD_BANK_OFFSET] != 0xAA) {
+        return VGAROM_ERR_NOT_ROM;
+    }
+    return VGAROM_OK;
+}
+
+int vgarom_open_mem(vgarom_t *rom, const uint8_t *image, int size,
+                    unsigned flags, uint8_t *work) {
+    int err = vgarom_check_image(image, size, flags);
+    if (err != VGAROM_OK) {
+        return err;
+    }
+    if (work == image && !(flags & VGAROM_LINEAR)) {
+        return VGAROM_ERR_ARG;
+    }
+
+    memset(rom, 0, sizeof(*rom));
+    if (!work) {
+        work = malloc(size);
+        if (!work) {
+            return VGAROM_ERR_NOMEM;
+        }
+        rom->owns_data = 1;
+    }
+    rom->data = work;
+    rom->size = size;
+    rom->flags = flags;
+    for (int f = 0; f < VGAROM_FONT_COUNT; f++) {
+        rom->font_offset[f] = -1;
+        rom->font_score[f] = 0;
+    }
+    clear_alt_tables(rom);
+    rom->int10_handler = -1;
+
+    analyze_rom(image, work, size, (flags & VGAROM_LINEAR) ? 0 : ODD_BANK_OFFSET, &rom->analysis);
+    rom->sum = rom->analysis.sum;
+    return VGAROM_OK;
+}
+
+int vgarom_copy(vgarom_t *dst, const vgarom_t *src, uint8_t *work) {
+    // До любой ошибки dst - закрытый образ: vgarom_close() для него
+    // ничего не освобождает и не трогает буферы src
+    dst->data = NULL;
+    dst->owns_data = 0;
+    dst->track = 0;
+    dst->changes = NULL;
+    dst->nchanges = dst->changes_cap = 0;
+    if (!src->data || work == src->data) {
+        return VGAROM_ERR_ARG;
+    }
+    int owns_data = 0;
+    if (!work) {
+        work = malloc(src->size);
+        if (!work) {
+            return VGAROM_ERR_NOMEM;
+        }
+        owns_data = 1;
+    }
+    memcpy(work, src->data, src->size);
+    *dst = *src;
+    dst->data = work;
+    dst->owns_data = owns_data;
+    dst->track = 0;
+    dst->changes = NULL;
+    dst->nchanges = dst->changes_cap = 0;
+    return VGAROM_OK;
+}
+
+void vgarom_close(vgarom_t *rom) {
+    if (rom->owns_data) {
+        free(rom->data);
+    }
+    free(rom->changes);
+    rom->data = NULL;
+    rom->owns_data = 0;
+    rom->changes = NULL;
+    rom->nchanges = rom->changes_cap = 0;
+}
+
+void vgarom_track_changes(vgarom_t *rom) {
+    rom->track = 1;
+}
+
+// Запоминает изменённую область; запись вплотную к предыдущей или
+// внутри неё расширяет ту же область
+static void record_change(vgarom_t *rom, int offset, int len) {
+    if (rom->track <= 0) {
+        return;
+    }
+    if (rom->nchanges > 0) {
+        vgarom_range_t *last = &rom->changes[rom->nchanges - 1];
+        if (offset >= last->offset && offset <= last->offset + last->len) {
+            if (offset + len > last->offset + last->len) {
+                last->len = offset + len - last->offset;
+            }
+            return;
+        }
+    }
+    if (rom->nchanges == rom->changes_cap) {
+        int cap = rom->changes_cap ? rom->changes_cap * 2 : 16;
+        vgarom_range_t *p = realloc(rom->changes, cap * sizeof(*p));
+        if (!p) {
+            rom->track = -1;
+            return;
+        }
+        rom->changes = p;
+        rom->changes_cap = cap;
+    }
+    rom->changes[rom->nchanges].offset = offset;
+    rom->changes[rom->nchanges].len = len;
+    rom->nchanges++;
+}
+
+// Таблицы по указателям INT 10h/1130h. Принимаются, только если
+// проходят ту же проверку, что и сохранённая разметка.
+static int locate_by_pointers(vgarom_t *rom) {
+    font_pointers_t ptrs;
+
+    if (find_font_pointers(rom->data, rom->size, &ptrs) != 0) {
+        return 0;
+    }
+    font_layout_t layout = {
+        .offset_8x8 = ptrs.offset_8x8,
+        .offset_8x14 = ptrs.offset_8x14,
+        .offset_8x16 = ptrs.offset_8x16,
+    };
+    if (!verify_font_layout(rom->data, rom->size, &layout)) {
+        return 0;
+    }
+    rom->font_offset[VGAROM_FONT_8X8] = ptrs.offset_8x8;
+    rom->font_offset[VGAROM_FONT_8X14] = ptrs.offset_8x14;
+    rom->font_offset[VGAROM_FONT_8X16] = ptrs.offset_8x16;
+    const int alt_offset[VGAROM_ALT_COUNT] = { ptrs.offset_9x14, ptrs.offset_9x16 };
+    for (int a = 0; a < VGAROM_ALT_COUNT; a++) {
+        index_alt_table(rom->data, rom->size, alt_offset[a], alt_heights[a], &rom->alt[a]);
+    }
+    rom->int10_handler = ptrs.handler;
+    return 1;
+}
+
+int vgarom_locate_fonts(vgarom_t *rom) {
+    font_layout_t layout;
+
+    for (int f = 0; f < VGAROM_FONT_COUNT; f++) {
+        rom->font_score[f] = 0;
+    }
+    clear_alt_tables(rom);
+    rom->int10_handler = -1;
+    if (locate_by_pointers(rom)) {
+        return VGAROM_OK;
+    }
+
+    locate_fonts_analyzed(rom->data, rom->size, &rom->analysis, &layout);
+    rom->font_offset[VGAROM_FONT_8X8] = layout.offset_8x8;
+    rom->font_offset[VGAROM_FONT_8X14] = layout.offset_8x14;
+    rom->font_offset[VGAROM_FONT_8X16] = layout.offset_8x16;
+    if (rom->font_offset[VGAROM_FONT_8X8] >= 0 && rom->font_offset[VGAROM_FONT_8X14] >= 0 &&
+        rom->font_offset[VGAROM_FONT_8X16] >= 0) {
+        return VGAROM_OK;
+    }
+
+    // Недостающие таблицы - лучший кандидат эвристики, не задевающий
+    // найденные по сигнатуре
+    font_candidate_t cands[FONT_MAX_CANDIDATES];
+    int ncands = rank_font_tables(rom->data, rom->size, cands, FONT_MAX_CANDIDATES);
+    for (int i = 0; i < ncands && cands[i].score >= FONT_ACCEPT_SCORE; i++) {
+        int f = cands[i].font;
+        int overlap = rom->font_offset[f] >= 0;
+        for (int g = 0; g < VGAROM_FONT_COUNT && !overlap; g++) {
+            overlap = rom->font_offset[g] >= 0 && rom->font_score[g] == 0 &&
+                      cands[i].offset < rom->font_offset[g] + font_sizes[g] &&
+                      rom->font_offset[g] < cands[i].offset + font_sizes[f];
+        }
+        if (!overlap) {
+            rom->font_offset[f] = cands[i].offset;
+            rom->font_score[f] = cands[i].score;
+        }
+    }
+    return VGAROM_OK;
+}
+
+int vgarom_rank_fonts(const vgarom_t *rom, font_candidate_t *cands, int max_cands) {
+    return rank_font_tables(rom->data, rom->size, cands, max_cands);
+}
+
+int vgarom_set_fonts(vgarom_t *rom, const int offset[VGAROM_FONT_COUNT]) {
+    font_layout_t layout = {
+        .offset_8x8 = offset[VGAROM_FONT_8X8],
+        .offset_8x14 = offset[VGAROM_FONT_8X14],
+        .offset_8x16 = offset[VGAROM_FONT_8X16],
+    };
+
+    if (!verify_font_layout(rom->data, rom->size, &layout)) {
+        return VGAROM_ERR_MISMATCH;
+    }
+    for (int f = 0; f < VGAROM_FONT_COUNT; f++) {
+        rom->font_offset[f] = offset[f];
+        rom->font_score[f] = 0;
+    }
+    clear_alt_tables(rom);
+    rom->int10_handler = -1;
+    return VGAROM_OK;
+}
+
+int vgarom_set_alt_tables(vgarom_t *rom, const int offset[VGAROM_ALT_COUNT]) {
+    vgarom_alt_t alt[VGAROM_ALT_COUNT];
+
+    for (int a = 0; a < VGAROM_ALT_COUNT; a++) {
+        if (index_alt_table(rom->data, rom->size, offset[a], alt_heights[a], &alt[a]) != 0) {
+            return VGAROM_ERR_MISMATCH;
+        }
+    }
+    memcpy(rom->alt, alt, sizeof(alt));
+    return VGAROM_OK;
+}
+
+int vgarom_alt_glyph(const vgarom_t *rom, int alt, int c) {
+    if (alt < 0 || alt >= VGAROM_ALT_COUNT || c < 0 || c > 255 ||
+        rom->alt[alt].record[c] == VGAROM_ALT_NONE) {
+        return -1;
+    }
+    const vgarom_alt_t *t = &rom->alt[alt];
+    return t->offset + t->record[c] * (t->height + 1) + 1;
+}
+
+// Все изменения образа идут через эту функцию: она поправляет сумму
+// только по изменённым байтам, поэтому контрольная сумма в конце
+// ставится без повторного суммирования всего образа
+int vgarom_write(vgarom_t *rom, int offset, const uint8_t *data, int len) {
+    if (offset < 0 || offset >= rom->size || len <= 0) {
+        return 0;
+    }
+    if (len > rom->size - offset) {
+        len = rom->size - offset;
+    }
+
+    // Последний байт - сама контрольная сумма, в сумму не входит
+    int summed = (offset + len == rom->size) ? len - 1 : len;
+    rom->sum += byte_sum(data, summed) - byte_sum(rom->data + offset, summed);
+    memcpy(rom->data + offset, data, len);
+    record_change(rom, offset, len);
+    return len;
+}
+
+int vgarom_replace_font(vgarom_t *rom, int font, const uint8_t *data, int size) {
+    if (font < 0 || font >= VGAROM_FONT_COUNT || !data || size < 0) {
+        return VGAROM_ERR_ARG;
+    }
+    if (rom->font_offset[font] < 0) {
+        return VGAROM_ERR_NO_FONT;
+    }
+
+    int copy_size = (size < font_sizes[font]) ? size : font_sizes[font];
+    vgarom_write(rom, rom->font_offset[font], data, copy_size);
+    int alt = alt_for_font(font);
+    if (alt >= 0 && rom->alt[alt].offset >= 0) {
+        vgarom_replace_alt(rom, alt, data, copy_size);
+    }
+    return VGAROM_OK;
+}
+
+// Таблица собирается в буфере и записывается одним куском, так что
+// в список изменений она попадает одной областью
+int vgarom_replace_alt(vgarom_t *rom, int alt, const uint8_t *font, int size) {
+    uint8_t buf[VGAROM_ALT_NONE * (VGAROM_GLYPH_SIZE_8X16 + 1)];
+
+    if (alt < 0 || alt >= VGAROM_ALT_COUNT || !font || size < 0) {
+        return VGAROM_ERR_ARG;
+    }
+    const vgarom_alt_t *t = &rom->alt[alt];
+    if (t->offset < 0) {
+        return VGAROM_ERR_NO_FONT;
+    }
+    int rec = t->height + 1;
+    int len = t->nrecords * rec;
+    int replaced = 0;
+    memcpy(buf, rom->data + t->offset, len);
+    for (int i = 0; i < t->nrecords; i++) {
+        uint8_t *r = buf + i * rec;
+        if ((r[0] + 1) * t->height <= size) {
+            memcpy(r + 1, font + r[0] * t->height, t->height);
+            replaced++;
+        }
+    }
+    vgarom_write(rom, t->offset, buf, len);
+    return replaced;
+}
+
+// Хеш-таблица глифов DOS-шрифта, отличающихся от шрифта в ROM.
+// Ключ - 16 байт глифа, значение - номер символа.
+#define GLYPH_TABLE_BITS 10
+#define GLYPH_TABLE_SIZE (1 << GLYPH_TABLE_BITS)
+
+typedef struct {
+    uint64_t key[GLYPH_TABLE_SIZE][2];
+    int16_t char_idx[GLYPH_TABLE_SIZE];   // -1 - пустая ячейка
+} glyph_table_t;
+
+static inline void glyph_key(const uint8_t *p, uint64_t key[2]) {
+    memcpy(key, p, VGAROM_GLYPH_SIZE_8X16);
+}
+
+static inline unsigned glyph_hash(const uint64_t key[2]) {
+    uint64_t h = key[0] * 0x9E3779B97F4A7C15ULL ^ key[1] * 0xC2B2AE3D27D4EB4FULL;
+    return (unsigned)(h >> (64 - GLYPH_TABLE_BITS));
+}
+
+// Добавляет глиф; при повторе остаётся символ с меньшим номером,
+// как и при посимвольном поиске
+static void glyph_table_add(glyph_table_t *t, const uint8_t *glyph, int char_idx) {
+    uint64_t key[2];
+    glyph_key(glyph, key);
+    for (unsigned i = glyph_hash(key); ; i = (i + 1) & (GLYPH_TABLE_SIZE - 1)) {
+        if (t->char_idx[i] < 0) {
+            t->key[i][0] = key[0];
+            t->key[i][1] = key[1];
+            t->char_idx[i] = char_idx;
+            return;
+        }
+        if (t->key[i][0] == key[0] && t->key[i][1] == key[1]) {
+            return;
+        }
+    }
+}
+
+// Счётчики поиска для статистики
+typedef struct {
+    long candidates;
+    long compares;
+    int fuzzy_hits;
+} scan_counters_t;
+
+static inline int glyph_table_find(const glyph_table_t *t, const uint8_t *p, scan_counters_t *c) {
+    uint64_t key[2];
+    glyph_key(p, key);
+    unsigned i = glyph_hash(key);
+    if (t->char_idx[i] >= 0) {
+        c->candidates++;
+    }
+    for (; t->char_idx[i] >= 0; i = (i + 1) & (GLYPH_TABLE_SIZE - 1)) {
+        c->compares++;
+        if (t->key[i][0] == key[0] && t->key[i][1] == key[1]) {
+            return t->char_idx[i];
+        }
+    }
+    return -1;
+}
+
+// Строит таблицу глифов DOS-шрифта, отличающихся от шрифта 8x16 в ROM.
+// Возвращает их число.
+static int build_glyph_table(const vgarom_t *rom, const uint8_t *dosfont, glyph_table_t *table) {
+    const int max_chars = FONT_8X16_SIZE / VGAROM_GLYPH_SIZE_8X16;
+    const uint8_t *fontrom = rom->data + rom->font_offset[VGAROM_FONT_8X16];
+    int patterns_found = 0;
+
+    memset(table->char_idx, 0xFF, sizeof(table->char_idx));
+    for (int char_idx = 0; char_idx < max_chars; char_idx++) {
+        const uint8_t *fontrom_char = fontrom + (char_idx * VGAROM_GLYPH_SIZE_8X16);
+        const uint8_t *dosfont_char = dosfont + (char_idx * VGAROM_GLYPH_SIZE_8X16);
+
+        if (memcmp(fontrom_char, dosfont_char, VGAROM_GLYPH_SIZE_8X16) != 0) {
+            patterns_found++;
+            glyph_table_add(table, dosfont_char, char_idx);
+        }
+    }
+    return patterns_found;
+}
+
+static void fill_stats(vgarom_pattern_stats_t *stats, int found, int replaced,
+                       long scanned, const scan_counters_t *c) {
+    if (stats) {
+        stats->chars_compared = FONT_8X16_SIZE / VGAROM_GLYPH_SIZE_8X16;
+        stats->patterns_found = found;
+        stats->patterns_replaced = replaced;
+        stats->bytes_scanned = scanned;
+        stats->candidates = c->candidates;
+        stats->compares = stats->chars_compared + c->compares;
+        stats->fuzzy_hits = c->fuzzy_hits;
+    }
+}
+
+// Глифы для нечёткого поиска, упорядоченные по числу точек: окно с p
+// точками отличается от глифа с q точками не меньше чем на |p - q| бит,
+// поэтому с окном сравниваются только глифы из start[p - k] .. start[p + k + 1]
+#define GLYPH_BITS (VGAROM_GLYPH_SIZE_8X16 * 8)
+
+typedef struct {
+    int max_bits;
+    int count;
+    uint8_t glyphs[FONT_8X16_SIZE];
+    int16_t char_idx[FONT_8X16_SIZE / VGAROM_GLYPH_SIZE_8X16];
+    int start[GLYPH_BITS + 2];
+} fuzzy_set_t;
+
+// Число единичных бит в байте
+#define BITS2(n) n, n + 1, n + 1, n + 2
+#define BITS4(n) BITS2(n), BITS2(n + 1), BITS2(n + 1), BITS2(n + 2)
+#define BITS6(n) BITS4(n), BITS4(n + 1), BITS4(n + 1), BITS4(n + 2)
+static const uint8_t byte_bits[256] = { BITS6(0), BITS6(1), BITS6(1), BITS6(2) };
+
+static int glyph_bits(const uint8_t *glyph) {
+    int n = 0;
+    for (int i = 0; i < VGAROM_GLYPH_SIZE_8X16; i++) {
+        n += byte_bits[glyph[i]];
+    }
+    return n;
+}
+
+static int glyph_distance(const uint8_t *a, const uint8_t *b) {
+    int n = 0;
+    for (int i = 0; i < VGAROM_GLYPH_SIZE_8X16; i++) {
+        n += byte_bits[a[i] ^ b[i]];
+    }
+    return n;
+}
+
+// Отбирает отличающиеся глифы из таблицы точного поиска: повторы уже
+// исключены в ней, а глифы, в которых меньше 4 * max_bits точек,
+// остаются только для точного поиска
+static void build_fuzzy_set(const vgarom_t *rom, const uint8_t *dosfont,
+                            const glyph_table_t *table, int max_bits, fuzzy_set_t *set) {
+    const int max_chars = FONT_8X16_SIZE / VGAROM_GLYPH_SIZE_8X16;
+    const uint8_t *fontrom = rom->data + rom->font_offset[VGAROM_FONT_8X16];
+    int count[GLYPH_BITS + 1] = { 0 };
+    int16_t chars[FONT_8X16_SIZE / VGAROM_GLYPH_SIZE_8X16];
+    int16_t pcs[FONT_8X16_SIZE / VGAROM_GLYPH_SIZE_8X16];
+    scan_counters_t unused = { 0, 0, 0 };
+    int n = 0;
+
+    set->max_bits = max_bits;
+    for (int char_idx = 0; char_idx < max_chars; char_idx++) {
+        const uint8_t *glyph = dosfont + char_idx * VGAROM_GLYPH_SIZE_8X16;
+        if (memcmp(fontrom + char_idx * VGAROM_GLYPH_SIZE_8X16, glyph, VGAROM_GLYPH_SIZE_8X16) == 0 ||
+            glyph_table_find(table, glyph, &unused) != char_idx) {
+            continue;
+        }
+        int pc = glyph_bits(glyph);
+        if (pc < 4 * max_bits) {
+            continue;
+        }
+        chars[n] = char_idx;
+        pcs[n++] = pc;
+        count[pc]++;
+    }
+
+    // Сортировка подсчётом, внутри группы - по номеру символа
+    set->start[0] = 0;
+    for (int p = 0; p <= GLYPH_BITS; p++) {
+        set->start[p + 1] = set->start[p] + count[p];
+    }
+    int fill[GLYPH_BITS + 1];
+    memcpy(fill, set->start, sizeof(fill));
+    for (int i = 0; i < n; i++) {
+        int j = fill[pcs[i]]++;
+        set->char_idx[j] = chars[i];
+        memcpy(set->glyphs + j * VGAROM_GLYPH_SIZE_8X16,
+               dosfont + chars[i] * VGAROM_GLYPH_SIZE_8X16, VGAROM_GLYPH_SIZE_8X16);
+    }
+    set->count = n;
+}
+
+// Ближайший к окну глиф с не больше чем max_bits отличиями. Возвращает
+// номер символа или -1, если такого нет или ближайших глифов несколько.
+static int fuzzy_set_find(const fuzzy_set_t *set, const uint8_t *p, int pc,
+                          int *distance, scan_counters_t *c) {
+    int lo = pc - set->max_bits < 0 ? 0 : pc - set->max_bits;
+    int hi = pc + set->max_bits > GLYPH_BITS ? GLYPH_BITS : pc + set->max_bits;
+    int first = set->start[lo];
+    int n = set->start[hi + 1] - first;
+
+    if (n == 0) {
+        return -1;
+    }
+    c->candidates++;
+    c->compares += n;
+    const uint8_t *glyphs = set->glyphs + first * VGAROM_GLYPH_SIZE_8X16;
+    int d = glyph_distance_min(p, glyphs, n);
+    if (d > set->max_bits) {
+        return -1;
+    }
+
+    // Совпадения редки: символ определяется повторным проходом
+    int found = -1;
+    for (int i = 0; i < n; i++) {
+        if (glyph_distance(p, glyphs + i * VGAROM_GLYPH_SIZE_8X16) == d) {
+            if (found >= 0) {
+                return -1;
+            }
+            found = set->char_idx[first + i];
+        }
+    }
+    *distance = d;
+    return found;
+}
+
+// Таблицы шрифтов и исправлений 9-точечных шрифтов самого ROM: окна,
+// задевающие их, не ищутся и не заменяются. Иначе глиф 8x16 записался
+// бы поверх строк соседних глифов 8x14 или 8x8.
+#define MAX_FONT_REGIONS (VGAROM_FONT_COUNT + VGAROM_ALT_COUNT)
+
+typedef struct {
+    int start, end;
+} font_region_t;
+
+// Заполняет области по возрастанию начала. Возвращает их число.
+static int font_regions(const vgarom_t *rom, font_region_t *r) {
+    int n = 0;
+    for (int font = 0; font < VGAROM_FONT_COUNT; font++) {
+        if (rom->font_offset[font] >= 0) {
+            r[n].start = rom->font_offset[font];
+            r[n++].end = rom->font_offset[font] + vgarom_font_size(font);
+        }
+    }
+    for (int alt = 0; alt < VGAROM_ALT_COUNT; alt++) {
+        const vgarom_alt_t *t = &rom->alt[alt];
+        if (t->offset >= 0) {
+            r[n].start = t->offset;
+            r[n++].end = t->offset + t->nrecords * (t->height + 1) + 1;
+        }
+    }
+    for (int i = 1; i < n; i++) {
+        font_region_t x = r[i];
+        int j = i;
+        for (; j > 0 && r[j - 1].start > x.start; j--) {
+            r[j] = r[j - 1];
+        }
+        r[j] = x;
+    }
+    return n;
+}
+
+// Конец области, которую задевает окно с pos, или -1
+static int region_overlap(const font_region_t *r, int n, int pos) {
+    for (int i = 0; i < n; i++) {
+        if (pos + VGAROM_GLYPH_SIZE_8X16 > r[i].start && pos < r[i].end) {
+            return r[i].end;
+        }
+    }
+    return -1;
+}
+
+// Проход по ROM: каждое окно в 16 байт проверяется по хеш-таблице,
+// а при нечётком поиске (set != NULL) - ещё и по ближайшим глифам
+static int scan_dos_patterns(const vgarom_t *rom, const glyph_table_t *table,
+                             const fuzzy_set_t *set, vgarom_dos_hit_t *hits, int max_hits,
+                             long *scanned, scan_counters_t *counters) {
+    font_region_t regions[MAX_FONT_REGIONS];
+    const int nregions = font_regions(rom, regions);
+    const int end = rom->size - VGAROM_GLYPH_SIZE_8X16;
+    int next = 0;               // первая область, которая не позади окна
+    int nhits = 0;
+    int pos = 0;
+    int pc = 0, pc_pos = -2;    // число точек окна в pc_pos
+
+    while (pos <= end && nhits < max_hits) {
+        // Пропускаем таблицы шрифтов
+        while (next < nregions && regions[next].end <= pos) {
+            next++;
+        }
+        if (next < nregions && pos + VGAROM_GLYPH_SIZE_8X16 > regions[next].start) {
+            pos = regions[next].end;
+            continue;
+        }
+
+        const uint8_t *p = rom->data + pos;
+        int distance = 0;
+        int char_idx = glyph_table_find(table, p, counters);
+        if (char_idx < 0 && set && set->count > 0) {
+            // Число точек окна сдвигается вместе с ним
+            if (pc_pos == pos - 1) {
+                pc += byte_bits[p[VGAROM_GLYPH_SIZE_8X16 - 1]] - byte_bits[p[-1]];
+            } else {
+                pc = glyph_bits(p);
+            }
+            pc_pos = pos;
+            char_idx = fuzzy_set_find(set, p, pc, &distance, counters);
+            // Нечёткое вхождение не должно закрывать точное, которое
+            // начинается внутри него
+            for (int i = 1; char_idx >= 0 && i < VGAROM_GLYPH_SIZE_8X16 && pos + i <= end; i++) {
+                if (region_overlap(regions, nregions, pos + i) < 0 &&
+                    glyph_table_find(table, p + i, counters) >= 0) {
+                    char_idx = -1;
+                }
+            }
+            if (char_idx >= 0) {
+                counters->fuzzy_hits++;
+            }
+        }
+        if (char_idx >= 0) {
+            // Замена не трогает байты дальше этого блока, поэтому
+            // поиск по исходному образу даёт те же вхождения
+            hits[nhits].offset = pos;
+            hits[nhits].char_idx = char_idx;
+            hits[nhits].distance = distance;
+            nhits++;
+            pos += VGAROM_GLYPH_SIZE_8X16; // Переходим к следующему блоку
+            *scanned += VGAROM_GLYPH_SIZE_8X16;
+        } else {
+            pos++;
+            (*scanned)++;
+        }
+    }
+    return nhits;
+}
+
+int vgarom_find_dos_patterns(const vgarom_t *rom, const uint8_t *dosfont,
+                             vgarom_dos_hit_t *hits, int max_hits,
+                             vgarom_pattern_stats_t *stats) {
+    return vgarom_find_dos_patterns_fuzzy(rom, dosfont, 0, hits, max_hits, stats);
+}
+
+int vgarom_find_dos_patterns_fuzzy(const vgarom_t *rom, const uint8_t *dosfont, int max_bits,
+                                   vgarom_dos_hit_t *hits, int max_hits,
+                                   vgarom_pattern_stats_t *stats) {
+    int nhits = 0;
+    long scanned = 0;
+    scan_counters_t counters = { 0, 0, 0 };
+    glyph_table_t table;
+    fuzzy_set_t *set = NULL;
+
+    if (!dosfont || !hits || max_bits < 0 || max_bits > VGAROM_MAX_FUZZY_BITS) {
+        return VGAROM_ERR_ARG;
+    }
+    if (rom->font_offset[VGAROM_FONT_8X16] < 0) {
+        return VGAROM_ERR_NO_FONT;
+    }
+
+    int patterns_found = build_glyph_table(rom, dosfont, &table);
+    if (patterns_found > 0 && max_bits > 0) {
+        set = malloc(sizeof(*set));
+        if (!set) {
+            return VGAROM_ERR_NOMEM;
+        }
+        build_fuzzy_set(rom, dosfont, &table, max_bits, set);
+    }
+
+    // Ищем паттерны во всем ROM, кроме таблиц шрифтов
+    if (patterns_found > 0) {
+        nhits = scan_dos_patterns(rom, &table, set, hits, max_hits, &scanned, &counters);
+    }
+    free(set);
+
+    fill_stats(stats, patterns_found, nhits, scanned, &counters);
+    return nhits;
+}
+
+int vgarom_verify_dos_hits(const vgarom_t *rom, const uint8_t *dosfont,
+                           const vgarom_dos_hit_t *hits, int nhits,
+                           vgarom_pattern_stats_t *stats) {
+    font_region_t regions[MAX_FONT_REGIONS];
+    const int nregions = font_regions(rom, regions);
+    scan_counters_t counters = { 0, 0, 0 };
+    glyph_table_t table;
+
+    if (!dosfont || (!hits && nhits > 0)) {
+        return VGAROM_ERR_ARG;
+    }
+    if (rom->font_offset[VGAROM_FONT_8X16] < 0) {
+        return VGAROM_ERR_NO_FONT;
+    }
+
+    int patterns_found = build_glyph_table(rom, dosfont, &table);
+    for (int i = 0; i < nhits; i++) {
+        int pos = hits[i].offset;
+        if (pos < 0 || pos > rom->size - VGAROM_GLYPH_SIZE_8X16 ||
+            region_overlap(regions, nregions, pos) >= 0 ||
+            (i > 0 && pos < hits[i - 1].offset + VGAROM_GLYPH_SIZE_8X16) ||
+            glyph_table_find(&table, rom->data + pos, &counters) != hits[i].char_idx) {
+            return VGAROM_ERR_MISMATCH;
+        }
+    }
+
+    fill_stats(stats, patterns_found, nhits, (long)nhits * VGAROM_GLYPH_SIZE_8X16, &counters);
+    return VGAROM_OK;
+}
+
+int vgarom_apply_dos_patterns(vgarom_t *rom, const vgarom_dos_hit_t *hits, int nhits,
+                              const uint8_t *newfont) {
+    if (!newfont || (!hits && nhits > 0)) {
+        return VGAROM_ERR_ARG;
+    }
+    for (int i = 0; i < nhits; i++) {
+        // Нашли паттерн - заменяем на символ из нового шрифта
+        vgarom_write(rom, hits[i].offset, newfont + (hits[i].char_idx * VGAROM_GLYPH_SIZE_8X16),
+                     VGAROM_GLYPH_SIZE_8X16);
+    }
+    return VGAROM_OK;
+}
+
+int vgarom_replace_dos_patterns(vgarom_t *rom, const uint8_t *dosfont,
+                                const uint8_t *newfont,
+                                vgarom_pattern_stats_t *stats) {
+    if (!newfont) {
+        return VGAROM_ERR_ARG;
+    }
+
+    int max_hits = VGAROM_MAX_DOS_HITS(rom->size);
+    vgarom_dos_hit_t *hits = malloc(max_hits * sizeof(*hits));
+    if (!hits) {
+        return VGAROM_ERR_NOMEM;
+    }
+
+    int nhits = vgarom_find_dos_patterns(rom, dosfont, hits, max_hits, stats);
+    if (nhits >= 0) {
+        vgarom_apply_dos_patterns(rom, hits, nhits, newfont);
+    }
+    free(hits);
+    return nhits < 0 ? nhits : VGAROM_OK;
+}
+
+uint8_t vgarom_update_checksum(vgarom_t *rom) {
+    #ifdef __DEBUG__
+    if (byte_sum(rom->data, rom->size - 1) != rom->sum) {
+        fprintf(stderr, "Warning: tracked byte sum 0x%02X differs from the image\n", rom->sum);
+    }
+    #endif
+
+    rom->data[rom->size - 1] = (uint8_t)(0x100 - rom->sum);
+    record_change(rom, rom->size - 1, 1);
+    return rom->data[rom->size - 1];
+}
+
+static int range_before(const void *a, const void *b) {
+    const vgarom_range_t *x = a, *y = b;
+    return (x->offset > y->offset) - (x->offset < y->offset);
+}
+
+int vgarom_changes(const vgarom_t *rom, unsigned flags, vgarom_range_t **ranges) {
+    *ranges = NULL;
+    if (rom->track < 0) {
+        return VGAROM_ERR_NOMEM;
+    }
+
+    // В чётно-нечётном порядке область распадается на две: чётные
+    // байты 2k лежат по адресу k, нечётные 2k+1 - по ODD_BANK_OFFSET + k
+    int n = 0;
+    vgarom_range_t *r = malloc((2 * rom->nchanges + 1) * sizeof(*r));
+    if (!r) {
+        return VGAROM_ERR_NOMEM;
+    }
+    for (int i = 0; i < rom->nchanges; i++) {
+        int a = rom->changes[i].offset;
+        int b = a + rom->changes[i].len;
+        if (flags & VGAROM_LINEAR) {
+            r[n++] = rom->changes[i];
+            continue;
+        }
+        if ((b + 1) / 2 > (a + 1) / 2) {
+            r[n].offset = (a + 1) / 2;
+            r[n++].len = (b + 1) / 2 - (a + 1) / 2;
+        }
+        if (b / 2 > a / 2) {
+            r[n].offset = ODD_BANK_OFFSET + a / 2;
+            r[n++].len = b / 2 - a / 2;
+        }
+    }
+
+    // Сортировка и слияние перекрывающихся и соседних областей
+    if (n > 1) {
+        qsort(r, n, sizeof(*r), range_before);
+    }
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+        if (m > 0 && r[i].offset <= r[m - 1].offset + r[m - 1].len) {
+            int end = r[i].offset + r[i].len;
+            if (end > r[m - 1].offset + r[m - 1].len) {
+                r[m - 1].len = end - r[m - 1].offset;
+            }
+        } else {
+            r[m++] = r[i];
+        }
+    }
+    *ranges = r;
+    return m;
+}
+
+int vgarom_serialize(const vgarom_t *rom, const uint8_t *image, uint8_t *out, int size,
+                     unsigned flags) {
+    if (!out || size != rom->size) {
+        return VGAROM_ERR_ARG;
+    }
+    if (flags & VGAROM_LINEAR) {
+        if (out != rom->data) {
+            memcpy(out, rom->data, size);
+        }
+        return VGAROM_OK;
+    }
+    if (out == rom->data || size < ODD_BANK_OFFSET * 2) {
+        return out == rom->data ? VGAROM_ERR_ARG : VGAROM_ERR_SIZE;
+    }
+    interleave(rom->data, out, size, ODD_BANK_OFFSET);
+
+    // Хвост, в который перемешивание не пишет
+    int covered = ODD_BANK_OFFSET + size / 2;
+    if (covered < size) {
+        if (!image) {
+            memset(out + covered, 0, size - covered);
+        } else if (image != out) {
+            memcpy(out + covered, image + covered, size - covered);
+        }
+    }
+    return VGAROM_OK;
+}
+
+const char *vgarom_strerror(int err) {
+    switch (err) {
+        case VGAROM_OK:
+            return "Success";
+        case VGAROM_ERR_ARG:
+            return "Invalid argument";
+        case VGAROM_ERR_NOMEM:
+            return "Memory allocation failed";
+        case VGAROM_ERR_SIZE:
+            return "Image is too small for odd/even layout";
+        case VGAROM_ERR_NOT_ROM:
+            return "Image is not a BIOS ROM (no 55 AA header)";
+        case VGAROM_ERR_NO_FONT:
+            return "Font table not found";
+        case VGAROM_ERR_MISMATCH:
+            return "Stored layout does not match the image";
+        default:
+            return "Unknown error";
+    }
+}
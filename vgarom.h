@@ -0,0 +1,223 @@
+#ifndef ___VGAROM_H___
+#define ___VGAROM_H___
+
+// libvgarom - работа со шрифтами в образах ROM BIOS VGA-карт в памяти.
+// Функции не печатают сообщений и не завершают процесс, а возвращают
+// коды ошибок VGAROM_*; текст ошибки даёт vgarom_strerror().
+
+#include <stdint.h>
+#include "fontscan.h"
+#include "fontptr.h"
+
+// Коды ошибок
+#define VGAROM_OK              0
+#define VGAROM_ERR_ARG        -1    // неверный аргумент
+#define VGAROM_ERR_NOMEM      -2    // не хватило памяти
+#define VGAROM_ERR_SIZE       -3    // образ мал для чётно-нечётного порядка
+#define VGAROM_ERR_NOT_ROM    -4    // нет заголовка 55 AA
+#define VGAROM_ERR_NO_FONT    -5    // таблица шрифта не найдена
+#define VGAROM_ERR_MISMATCH   -6    // сохранённая разметка не подходит к образу
+
+// Флаги образа
+#define VGAROM_LINEAR   0x01        // линейный порядок байт (иначе чётно-нечётный)
+
+// Таблицы шрифтов
+enum {
+    VGAROM_FONT_8X8,
+    VGAROM_FONT_8X14,
+    VGAROM_FONT_8X16,
+    VGAROM_FONT_COUNT
+};
+
+// Таблицы исправлений 9-точечных шрифтов (см. fontptr.h)
+enum {
+    VGAROM_ALT_9X14,
+    VGAROM_ALT_9X16,
+    VGAROM_ALT_COUNT
+};
+
+#define VGAROM_GLYPH_SIZE_8X16 16
+
+// Таблица исправлений 9-точечного шрифта: записи (код символа, глиф
+// 8x14 или 8x16) и индекс записей по коду символа
+#define VGAROM_ALT_NONE 0xFF
+
+typedef struct {
+    int offset;             // -1 - не найдена
+    int height;             // высота глифа записи
+    int nrecords;
+    uint8_t record[256];    // номер записи символа, VGAROM_ALT_NONE - нет
+} vgarom_alt_t;
+
+// Наибольшее число вхождений глифов в образе размера size
+#define VGAROM_MAX_DOS_HITS(size) ((size) / VGAROM_GLYPH_SIZE_8X16 + 1)
+
+// Область образа
+typedef struct {
+    int offset;
+    int len;
+} vgarom_range_t;
+
+// Открытый образ. Поля можно читать, но менять только через функции.
+typedef struct {
+    uint8_t *data;          // рабочий образ в линейном порядке
+    int size;
+    uint8_t sum;            // сумма всех байт, кроме последнего
+    unsigned flags;         // флаги исходного образа
+    int owns_data;          // data выделена библиотекой
+    rom_analysis_t analysis;
+    int font_offset[VGAROM_FONT_COUNT];  // -1 - не найдена
+    int font_score[VGAROM_FONT_COUNT];   // оценка таблицы, найденной эвристикой,
+                                         // 0 - по сигнатуре или задана извне
+    vgarom_alt_t alt[VGAROM_ALT_COUNT];
+    int int10_handler;      // обработчик INT 10h, по указателям которого найдены
+                            // таблицы, -1 - таблицы найдены поиском
+    int track;              // 1 - изменения записываются, -1 - список потерян
+    vgarom_range_t *changes;    // изменённые области рабочего образа
+    int nchanges;
+    int changes_cap;
+} vgarom_t;
+
+// Результат замены паттернов DOS-шрифта
+typedef struct {
+    int chars_compared;
+    int patterns_found;     // символы, отличающиеся от шрифта в ROM
+    int patterns_replaced;  // замены в остальной части ROM
+    long bytes_scanned;     // байты ROM, просмотренные поиском
+    long candidates;        // окна, попавшие в занятую ячейку таблицы глифов
+    long compares;          // сравнения глифов (шрифтов и ключей таблицы)
+    int fuzzy_hits;         // вхождения с отличающимися битами
+} vgarom_pattern_stats_t;
+
+// Вхождение глифа DOS-шрифта в ROM
+typedef struct {
+    int offset;
+    int char_idx;
+    int distance;           // число отличающихся бит, 0 - точное совпадение
+} vgarom_dos_hit_t;
+
+// Наибольшее допустимое расстояние нечёткого поиска
+#define VGAROM_MAX_FUZZY_BITS 16
+
+// Проверяет размер и заголовок 55 AA образа без его разбора
+int vgarom_check_image(const uint8_t *image, int size, unsigned flags);
+
+// Открывает образ из памяти. Рабочий линейный образ строится в work
+// (size байт, может совпадать с image для линейного образа); если
+// work == NULL, буфер выделяется и освобождается в vgarom_close().
+// За тот же проход считается сумма и собираются якоря шрифтов.
+int vgarom_open_mem(vgarom_t *rom, const uint8_t *image, int size,
+                    unsigned flags, uint8_t *work);
+
+// Копия открытого образа вместе с результатами разбора и найденными
+// таблицами, чтобы строить варианты одного образа без повторного
+// разбора. Данные копируются в work (size байт) или, если work == NULL,
+// в буфер, освобождаемый vgarom_close(). Изменения не записываются.
+// При ошибке dst остаётся закрытым, и vgarom_close() для него безопасен.
+int vgarom_copy(vgarom_t *dst, const vgarom_t *src, uint8_t *work);
+
+// Освобождает ресурсы образа
+void vgarom_close(vgarom_t *rom);
+
+// Находит таблицы 8x8, 8x14 и 8x16, заполняет rom->font_offset.
+// Сначала таблицы берутся из указателей, которые возвращает INT 10h
+// AX=1130h самого BIOS (find_font_pointers), вместе с таблицами
+// исправлений 9x14 и 9x16 в rom->alt. Если так найти не удалось,
+// таблицы ищутся по сигнатуре, а таблицы без сигнатуры (глифа 1
+// "смайлик") - эвристикой с оценкой от FONT_ACCEPT_SCORE; она пишется
+// в rom->font_score.
+int vgarom_locate_fonts(vgarom_t *rom);
+
+// Кандидаты в таблицы шрифтов по эвристике, по убыванию оценки
+// (см. rank_font_tables). Возвращает их число.
+int vgarom_rank_fonts(const vgarom_t *rom, font_candidate_t *cands, int max_cands);
+
+// Задаёт смещения таблиц, найденные раньше (например, сохранённые
+// в индексе), вместо поиска. Смещения проверяются по сигнатурам;
+// при несовпадении возвращает VGAROM_ERR_MISMATCH и ничего не меняет.
+int vgarom_set_fonts(vgarom_t *rom, const int offset[VGAROM_FONT_COUNT]);
+
+// Задаёт смещения таблиц исправлений 9x14 и 9x16 (-1 - нет таблицы),
+// найденные раньше, и строит их индексы. Если таблица по смещению не
+// разбирается, возвращает VGAROM_ERR_MISMATCH и ничего не меняет.
+int vgarom_set_alt_tables(vgarom_t *rom, const int offset[VGAROM_ALT_COUNT]);
+
+// Смещение в образе глифа символа c в таблице исправлений alt
+// или -1, если символа в таблице нет
+int vgarom_alt_glyph(const vgarom_t *rom, int alt, int c);
+
+// Перестраивает таблицу исправлений alt из шрифта той же высоты
+// (256 глифов, size байт): у каждой записи глиф заменяется глифом
+// её символа. Возвращает число заменённых записей или код ошибки.
+int vgarom_replace_alt(vgarom_t *rom, int alt, const uint8_t *font, int size);
+
+// Размер таблицы шрифта в байтах
+int vgarom_font_size(int font);
+
+// Записывает данные в рабочий образ с поправкой суммы байт.
+// Возвращает число записанных байт (запись обрезается по концу образа).
+int vgarom_write(vgarom_t *rom, int offset, const uint8_t *data, int len);
+
+// Заменяет таблицу шрифта. Копируется не больше размера таблицы.
+// Таблица исправлений той же высоты (9x14 для 8x14, 9x16 для 8x16)
+// перестраивается из новых глифов (vgarom_replace_alt).
+int vgarom_replace_font(vgarom_t *rom, int font, const uint8_t *data, int size);
+
+// Находит в ROM (кроме найденных таблиц шрифтов и таблиц исправлений
+// 9x14/9x16) глифы DOS-шрифта, которые отличаются от шрифта в ROM, и
+// заменяет их глифами newfont.
+// Оба шрифта - 256 символов 8x16. stats может быть NULL.
+int vgarom_replace_dos_patterns(vgarom_t *rom, const uint8_t *dosfont,
+                                const uint8_t *newfont,
+                                vgarom_pattern_stats_t *stats);
+
+// Две половины vgarom_replace_dos_patterns: поиск вхождений без
+// изменения образа и их замена. hits должен вмещать
+// VGAROM_MAX_DOS_HITS(rom->size) элементов. Возвращает число
+// вхождений или код ошибки.
+int vgarom_find_dos_patterns(const vgarom_t *rom, const uint8_t *dosfont,
+                             vgarom_dos_hit_t *hits, int max_hits,
+                             vgarom_pattern_stats_t *stats);
+int vgarom_apply_dos_patterns(vgarom_t *rom, const vgarom_dos_hit_t *hits, int nhits,
+                              const uint8_t *newfont);
+
+// Нечёткий поиск: кроме точных вхождений находит окна, отличающиеся от
+// глифа DOS-шрифта не больше чем на max_bits бит (0 - только точные).
+// Окно, одинаково близкое к разным глифам, и окно, внутри которого
+// начинается точное вхождение, не заменяются. Глифы, в
+// которых меньше 4 * max_bits точек, ищутся только точно: иначе за них
+// принимались бы почти пустые окна.
+int vgarom_find_dos_patterns_fuzzy(const vgarom_t *rom, const uint8_t *dosfont, int max_bits,
+                                   vgarom_dos_hit_t *hits, int max_hits,
+                                   vgarom_pattern_stats_t *stats);
+
+// Проверяет вхождения, найденные раньше: в каждом по-прежнему стоит
+// отличающийся от ROM глиф DOS-шрифта. Заполняет stats, как поиск.
+int vgarom_verify_dos_hits(const vgarom_t *rom, const uint8_t *dosfont,
+                           const vgarom_dos_hit_t *hits, int nhits,
+                           vgarom_pattern_stats_t *stats);
+
+// Записывает контрольную сумму в последний байт, возвращает её значение
+uint8_t vgarom_update_checksum(vgarom_t *rom);
+
+// Включает запись изменённых областей (после vgarom_open_mem)
+void vgarom_track_changes(vgarom_t *rom);
+
+// Изменённые с момента vgarom_track_changes области в порядке байт,
+// заданном flags, отсортированные и без перекрытий. Массив *ranges
+// выделяется функцией и освобождается вызывающим. Возвращает число
+// областей или код ошибки.
+int vgarom_changes(const vgarom_t *rom, unsigned flags, vgarom_range_t **ranges);
+
+// Записывает образ в out (size байт) в порядке, заданном flags.
+// Чётно-нечётный порядок образа больше 32 КБ не покрывает байты с
+// ODD_BANK_OFFSET + size / 2 до конца: они берутся с тех же смещений
+// исходного образа image (может совпадать с out), а при image == NULL
+// обнуляются.
+int vgarom_serialize(const vgarom_t *rom, const uint8_t *image, uint8_t *out, int size,
+                     unsigned flags);
+
+// Описание кода ошибки
+const char *vgarom_strerror(int err);
+
+#endif // ___VGAROM_H___
@@ -0,0 +1,125 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "workpool.h"
+
+// Очередь заданий одного потока: владелец берёт с конца,
+// остальные потоки крадут с начала
+typedef struct {
+    pthread_mutex_t lock;
+    int head;
+    int tail;
+} wp_deque_t;
+
+typedef struct {
+    wp_deque_t *deques;
+    int nthreads;
+    workpool_fn fn;
+    void *ctx;
+} wp_pool_t;
+
+typedef struct {
+    wp_pool_t *pool;
+    int id;
+} wp_worker_t;
+
+int workpool_default_threads(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
+static int wp_pop(wp_deque_t *dq) {
+    int idx = -1;
+    pthread_mutex_lock(&dq->lock);
+    if (dq->head < dq->tail) {
+        idx = --dq->tail;
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return idx;
+}
+
+static int wp_steal(wp_deque_t *dq) {
+    int idx = -1;
+    pthread_mutex_lock(&dq->lock);
+    if (dq->head < dq->tail) {
+        idx = dq->head++;
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return idx;
+}
+
+static void *wp_worker(void *arg) {
+    wp_worker_t *w = arg;
+    wp_pool_t *pool = w->pool;
+
+    for (;;) {
+        int idx = wp_pop(&pool->deques[w->id]);
+
+        // Своя очередь пуста - обходим чужие, начиная с соседа
+        for (int i = 1; idx < 0 && i < pool->nthreads; i++) {
+            idx = wp_steal(&pool->deques[(w->id + i) % pool->nthreads]);
+        }
+        // Новые задания не появляются, поэтому пустой обход означает конец
+        if (idx < 0) {
+            break;
+        }
+        pool->fn(idx, pool->ctx);
+    }
+    return NULL;
+}
+
+int workpool_run(int njobs, int nthreads, workpool_fn fn, void *ctx) {
+    if (njobs <= 0) {
+        return 0;
+    }
+    if (nthreads < 1) {
+        nthreads = 1;
+    }
+    if (nthreads > njobs) {
+        nthreads = njobs;
+    }
+
+    wp_pool_t pool = { .nthreads = nthreads, .fn = fn, .ctx = ctx };
+    pool.deques = calloc(nthreads, sizeof(*pool.deques));
+    wp_worker_t *workers = calloc(nthreads, sizeof(*workers));
+    pthread_t *threads = calloc(nthreads, sizeof(*threads));
+    if (!pool.deques || !workers || !threads) {
+        perror("Memory allocation failed");
+        free(pool.deques);
+        free(workers);
+        free(threads);
+        return -1;
+    }
+
+    // Раздаём задания непрерывными блоками
+    for (int t = 0; t < nthreads; t++) {
+        pthread_mutex_init(&pool.deques[t].lock, NULL);
+        pool.deques[t].head = (int)((long)njobs * t / nthreads);
+        pool.deques[t].tail = (int)((long)njobs * (t + 1) / nthreads);
+        workers[t].pool = &pool;
+        workers[t].id = t;
+    }
+
+    // Поток main работает как нулевой рабочий
+    int started = 1;
+    for (int t = 1; t < nthreads; t++, started++) {
+        if (pthread_create(&threads[t], NULL, wp_worker, &workers[t]) != 0) {
+            perror("Error creating worker thread");
+            break;
+        }
+    }
+    wp_worker(&workers[0]);
+
+    for (int t = 1; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    for (int t = 0; t < nthreads; t++) {
+        pthread_mutex_destroy(&pool.deques[t].lock);
+    }
+
+    free(pool.deques);
+    free(workers);
+    free(threads);
+    return 0;
+}
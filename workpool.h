@@ -0,0 +1,16 @@
+#ifndef ___WORKPOOL_H___
+#define ___WORKPOOL_H___
+
+// Функция, выполняющая одно задание с номером idx
+typedef void (*workpool_fn)(int idx, void *ctx);
+
+// Количество доступных процессоров (не меньше 1)
+int workpool_default_threads(void);
+
+// Выполняет задания 0..njobs-1 на пуле из nthreads потоков.
+// У каждого потока своя очередь заданий; освободившийся поток
+// забирает задания из начала чужих очередей (work stealing).
+// Возвращает 0 или -1, если не удалось запустить потоки.
+int workpool_run(int njobs, int nthreads, workpool_fn fn, void *ctx);
+
+#endif // ___WORKPOOL_H___